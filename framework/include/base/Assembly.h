@@ -12,6 +12,8 @@
 
 #include "MooseArray.h"
 #include "MooseTypes.h"
+#include "DualNumber.h"
+#include "TensorProductBasis.h"
 
 #include "libmesh/dense_matrix.h"
 #include "libmesh/dense_vector.h"
@@ -19,6 +21,9 @@
 #include "libmesh/fe_type.h"
 #include "libmesh/tensor_tools.h"
 
+#include <list>
+#include <memory>
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -605,6 +610,37 @@ public:
                                   const std::vector<dof_id_type> & jdof_indices,
                                   Real scaling_factor);
 
+  /**
+   * Position of the first element dof of the given variable in the derivative array of an ADReal,
+   * or libMesh::invalid_uint if the variable has not been seeded on the current element. The
+   * variables get consecutive slots in the order they are first seeded (see computeADValues()),
+   * so every AD object on the element uses a consistent derivative layout.
+   */
+  unsigned int adOffset(unsigned int var_num) const { return _ad_offsets[var_num]; }
+
+  /**
+   * Evaluate a variable and its gradient at the current volume quadrature points as dual numbers
+   * seeded with the derivatives with respect to the variable's element dofs. The first call for a
+   * variable on an element assigns its derivative slots.
+   */
+  void computeADValues(MooseVariable & var, ADVariableValue & u, ADVariableGradient & grad_u);
+
+  /**
+   * Scatter the derivatives of the element residual of variable \p ivar into the Jacobian blocks
+   * of all variables coupled to it.
+   * @param ivar The variable the residual belongs to
+   * @param residuals One dual number per test function of \p ivar
+   */
+  void addJacobianFromDerivatives(unsigned int ivar, const std::vector<ADReal> & residuals);
+
+  /**
+   * Scatter the derivatives of the element residual of \p ivar with respect to the dofs of
+   * \p jvar into the corresponding Jacobian block only.
+   */
+  void addJacobianBlockFromDerivatives(unsigned int ivar,
+                                       MooseVariableFE & jvar,
+                                       const std::vector<ADReal> & residuals);
+
   std::vector<std::pair<MooseVariableFE *, MooseVariableFE *>> & couplingEntries()
   {
     return _cm_entry;
@@ -911,11 +947,73 @@ public:
    */
   void addCachedJacobianContributions(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Apply Jacobian contributions to a vector instead of assembling them into a matrix. While a
+   * product vector is set, every block K that would be added to the Jacobian is applied as
+   * product += K * input and the matrix passed to the add/set routines is not touched. Rows set
+   * by setCachedJacobianContributions() replace whatever was accumulated in them before.
+   *
+   * @param input Ghosted vector the Jacobian is applied to, or nullptr to accumulate the
+   *        diagonal of the Jacobian into the product instead
+   * @param product Ghosted vector receiving the product, or nullptr to assemble matrices again
+   */
+  void setJacobianProduct(const NumericVector<Number> * input, NumericVector<Number> * product)
+  {
+    _jacobian_product_input = input;
+    _jacobian_product = product;
+  }
+
+  /// Whether Jacobian contributions are currently applied to a vector rather than assembled
+  bool computingJacobianProduct() const { return _jacobian_product != nullptr; }
+
   /**
    * Set the pointer to the XFEM controller object
    */
   void setXFEM(std::shared_ptr<XFEMInterface> xfem) { _xfem = xfem; }
 
+  /**
+   * Set the number of element geometries whose volume shape function values are kept around
+   * for reuse by reinit(elem). Elements that are translated copies of a cached element (same
+   * type, p-level, quadrature rule and node offsets) skip the FE reinit entirely. A size of
+   * zero (the default) disables the cache.
+   *
+   * Note that on a cache hit the libMesh FE objects are not reinitialized, so objects reading
+   * data directly from getFE() objects rather than through Assembly/MooseVariable will see
+   * the values of the last element that missed the cache.
+   */
+  void setElemShapeCacheSize(unsigned int size);
+
+  ///@{ Number of reinit(elem) calls served from / missing the element shape function cache
+  unsigned long long elemShapeCacheHits() const { return _elem_shape_cache_hits; }
+  unsigned long long elemShapeCacheMisses() const { return _elem_shape_cache_misses; }
+  ///@}
+
+  /**
+   * Enable or disable sum factorization. When enabled, reinit(elem) on QUAD9 and HEX27 elements
+   * integrated with a tensor product quadrature rule makes a TensorProductBasis available to
+   * second order Lagrange variables and kernels.
+   */
+  void setUseSumFactorization(bool use) { _use_sum_factorization = use; }
+
+  /**
+   * The sum factorization basis for the current element and volume quadrature rule, or nullptr
+   * if the element, the quadrature rule or the given FE type do not permit sum factorization.
+   */
+  const TensorProductBasis * tensorProductBasis(const FEType & fe_type) const
+  {
+    return fe_type == FEType(SECOND, LAGRANGE) ? _current_tensor_basis : nullptr;
+  }
+
+  /**
+   * Inverse Jacobian of the reference map at the volume quadrature points, only valid while
+   * tensorProductBasis() is not nullptr. Entry (r, d) is the derivative of reference coordinate
+   * r with respect to physical coordinate d.
+   */
+  const std::vector<RealTensor> & tensorInverseJacobian() const
+  {
+    return *_current_tensor_inverse_jacobian;
+  }
+
 protected:
   /**
    * Just an internal helper function to reinit the volume FE objects.
@@ -924,6 +1022,19 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Reinit the volume FE data for elem, serving it from the element shape function cache when a
+   * translated copy of elem has been seen before.
+   *
+   * @param elem The element we are using to reinit
+   */
+  void reinitFECached(const Elem * elem);
+
+  /**
+   * Select the sum factorization basis for the element just reinitialized by reinit(elem)
+   */
+  void reinitTensorProductBasis(const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -965,6 +1076,28 @@ protected:
                         const std::vector<dof_id_type> & jdof_indices,
                         Real scaling_factor);
 
+  ///@{
+  /**
+   * Add a dense block or a single entry to the Jacobian matrix, or apply it to the product
+   * vector when a Jacobian product is being computed
+   */
+  void addJacobianEntries(SparseMatrix<Number> & jacobian,
+                          const DenseMatrix<Number> & ke,
+                          const std::vector<dof_id_type> & idof_indices,
+                          const std::vector<dof_id_type> & jdof_indices);
+  void addJacobianEntry(SparseMatrix<Number> & jacobian,
+                        numeric_index_type i,
+                        numeric_index_type j,
+                        Real value);
+  ///@}
+
+  /**
+   * Zero the given rows of the Jacobian, or of the product vector when a Jacobian product is
+   * being computed. The product vector is not closed here; that is up to the caller, since
+   * closing is collective.
+   */
+  void zeroJacobianRows(SparseMatrix<Number> & jacobian, std::vector<numeric_index_type> & rows);
+
   /**
    * Clear any currently cached jacobian contributions
    *
@@ -1152,6 +1285,12 @@ protected:
   /// This will be filled up with the physical points passed into reinitAtPhysical() if it is called.  Invalid at all other times.
   MooseArray<Point> _current_physical_points;
 
+  /// Offsets of each variable's element dofs in the ADReal derivative arrays (see adOffset())
+  std::vector<unsigned int> _ad_offsets;
+
+  /// Number of derivative slots handed out on the current element
+  unsigned int _ad_n_seeded_dofs;
+
   /// residual contributions for each variable from the element
   std::vector<std::vector<DenseVector<Number>>> _sub_Re;
   /// residual contributions for each variable from the neighbor
@@ -1173,6 +1312,13 @@ protected:
   /// auxiliary matrix for scaling jacobians (optimization to avoid expensive construction/destruction)
   DenseMatrix<Number> _tmp_Ke;
 
+  /// Vector the Jacobian is applied to (nullptr when extracting the diagonal)
+  const NumericVector<Number> * _jacobian_product_input;
+  /// Vector receiving Jacobian contributions instead of the matrix, nullptr when assembling
+  NumericVector<Number> * _jacobian_product;
+  /// Product of a Jacobian block with the input (optimization to avoid reallocation)
+  DenseVector<Number> _tmp_jacobian_product;
+
   // Shape function values, gradients. second derivatives
   VariablePhiValue _phi;
   VariablePhiGradient _grad_phi;
@@ -1273,6 +1419,53 @@ protected:
   std::vector<Real> _cached_jacobian_contribution_vals;
   std::vector<numeric_index_type> _cached_jacobian_contribution_rows;
   std::vector<numeric_index_type> _cached_jacobian_contribution_cols;
+
+  /**
+   * Volume shape function data of one element geometry. The geometry is identified by the
+   * element type, p-level, quadrature rule and the (quantized) node coordinates relative to the
+   * first node, so it is shared by all elements that are translated copies of each other.
+   */
+  struct ElemShapeCacheEntry
+  {
+    std::size_t hash;
+    const QBase * qrule;
+    std::vector<long long> key;
+    /// First node of the element that filled this entry
+    Point origin;
+    std::vector<Point> q_points;
+    std::vector<Real> JxW;
+    std::map<FEType, std::vector<std::vector<Real>>> phi;
+    std::map<FEType, std::vector<std::vector<RealGradient>>> grad_phi;
+    std::map<FEType, std::vector<std::vector<RealTensor>>> second_phi;
+    /// Inverse Jacobian of the reference map, only filled for sum factorization candidates
+    std::vector<RealTensor> inverse_jacobian;
+  };
+
+  /// Cached element geometries, most recently used first
+  std::list<ElemShapeCacheEntry> _elem_shape_cache;
+  /// Maximum number of entries in _elem_shape_cache
+  unsigned int _elem_shape_cache_size;
+  /// Geometry key of the element currently being reinitialized
+  std::vector<long long> _elem_shape_key;
+  /// Quadrature points of a cache hit translated to the current element
+  std::vector<Point> _elem_shape_q_points;
+  unsigned long long _elem_shape_cache_hits;
+  unsigned long long _elem_shape_cache_misses;
+  /// Cache entry holding the data of the current element, nullptr if the cache was bypassed
+  ElemShapeCacheEntry * _current_elem_shape_entry;
+  /// Whether the current element was served from the cache
+  bool _current_elem_shape_hit;
+
+  /// Whether reinit(elem) looks for a sum factorization basis
+  bool _use_sum_factorization;
+  /// Sum factorization bases by element type and volume quadrature rule (nullptr if unsupported)
+  std::map<std::pair<ElemType, const QBase *>, std::unique_ptr<TensorProductBasis>> _tensor_bases;
+  /// Sum factorization basis of the current element
+  const TensorProductBasis * _current_tensor_basis;
+  /// Inverse Jacobian at the volume quadrature points, computed for sum factorization
+  std::vector<RealTensor> _tensor_inverse_jacobian;
+  /// Points either to _tensor_inverse_jacobian or into the element shape function cache
+  const std::vector<RealTensor> * _current_tensor_inverse_jacobian;
 };
 
 template <>
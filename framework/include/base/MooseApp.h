@@ -17,6 +17,7 @@
 #include "Factory.h"
 #include "ActionFactory.h"
 #include "OutputWarehouse.h"
+#include "ObjectProfiler.h"
 #include "RestartableData.h"
 #include "ConsoleStreamInterface.h"
 
@@ -380,6 +381,11 @@ public:
    */
   OutputWarehouse & getOutputWarehouse();
 
+  /**
+   * Get the profiler recording the time spent in the individual MooseObjects of this App
+   */
+  ObjectProfiler & getObjectProfiler() { return _object_profiler; }
+
   /**
    * Get SystemInfo object
    * @return A pointer to the SystemInformation object
@@ -459,6 +465,13 @@ public:
    */
   std::shared_ptr<Backup> backup();
 
+  /**
+   * Store the state of the App in an existing Backup, keeping copies of the system vectors in
+   * memory instead of serializing them. Repeated backups reuse the copies, so that backing up
+   * and restoring the systems is a vector copy.
+   */
+  void backupInMemory(Backup & backup);
+
   /**
    * Restore a Backup.  This sets the App's state.
    *
@@ -642,6 +655,9 @@ protected:
   /// OutputWarehouse object for this App
   OutputWarehouse _output_warehouse;
 
+  /// Per-object timers of this App
+  ObjectProfiler _object_profiler;
+
   /// Input parameter storage structure (this is a raw pointer so the destruction time can be explicitly controlled)
   InputParameterWarehouse * _input_parameter_warehouse;
 
@@ -42,6 +42,16 @@ public:
    */
   const std::string & name() const { return _name; }
 
+  /**
+   * Get the registered type of the object (empty if the object was not built by the Factory)
+   */
+  const std::string & type() const { return _type; }
+
+  /**
+   * Get the id of the ObjectProfiler section timing this object
+   */
+  unsigned int profilerId() const { return _profiler_id; }
+
   /**
    * Get the parameters of the object
    * @return The parameters of the object
@@ -136,6 +146,12 @@ protected:
 
   /// Reference to the "enable" InputParaemters, used by Controls for toggling on/off MooseObjects
   const bool & _enabled;
+
+  /// The type of this object as registered with the Factory
+  const std::string _type;
+
+  /// Section of this object in the ObjectProfiler (shared by all threaded copies)
+  const unsigned int _profiler_id;
 };
 
 template <typename T>
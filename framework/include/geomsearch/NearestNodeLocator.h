@@ -85,9 +85,41 @@ public:
 
     const Node * _nearest_node;
     Real _distance;
+
+    /// Distance to the second nearest node of the patch when the nearest node was searched
+    Real _second_distance;
+
+    /// How far through the patch the nearest node was found
+    Real _patch_percentage;
   };
 
 protected:
+  /**
+   * Search the nearest node of every slave node in its patch and save the positions the
+   * incremental search compares against.
+   */
+  void searchAllNodes();
+
+  /**
+   * Search the nearest node again only for the slave nodes whose nearest node may have changed
+   * since it was last searched.
+   *
+   * @return false if too many nodes moved and all of them should be searched instead
+   */
+  bool searchMovedNodes();
+
+  /// State of a slave node when its nearest node was last searched
+  struct SlaveSearchState
+  {
+    Point _position;
+
+    /// Difference between the distances to the second nearest and the nearest node
+    Real _gap;
+
+    /// Largest displacement of the patch master nodes since the last full search
+    Real _master_motion;
+  };
+
   SubProblem & _subproblem;
 
   MooseMesh & _mesh;
@@ -116,6 +148,18 @@ public:
 
   // The list of ghosted elements added during a time step for iteration patch update strategy
   std::vector<dof_id_type> _new_ghosted_elems;
+
+protected:
+  /// Whether the next search has to be done for all the slave nodes
+  bool _search_all_nodes;
+
+  /// Search state of each slave node, in the order of _slave_nodes
+  std::vector<SlaveSearchState> _slave_search_states;
+
+  ///@{ The master nodes of all the patches and their positions at the last full search
+  std::vector<dof_id_type> _patch_master_nodes;
+  std::vector<Point> _patch_master_positions;
+  ///@}
 };
 
 #endif // NEARESTNODELOCATOR_H
@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "MooseTypes.h"
 #include "PenetrationLocator.h"
+#include "CompressedMap.h"
 
 // Forward declarations
 template <typename>
@@ -37,7 +38,7 @@ public:
                     std::vector<std::vector<FEBase *>> & fes,
                     FEType & fe_type,
                     NearestNodeLocator & nearest_node,
-                    const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+                    const CompressedMap<dof_id_type, dof_id_type> & node_to_elem_map,
                     std::vector<dof_id_type> & elem_list,
                     std::vector<unsigned short int> & side_list,
                     std::vector<boundary_id_type> & id_list);
@@ -78,7 +79,7 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const CompressedMap<dof_id_type, dof_id_type> & _node_to_elem_map;
 
   std::vector<dof_id_type> & _elem_list;
   std::vector<unsigned short int> & _side_list;
@@ -14,6 +14,7 @@
 #include "MooseTypes.h"
 #include "NearestNodeLocator.h"
 #include "KDTree.h"
+#include "CompressedMap.h"
 
 // Forward declarations
 class MooseMesh;
@@ -27,7 +28,7 @@ public:
 
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+                          const CompressedMap<dof_id_type, dof_id_type> & node_to_elem_map,
                           const unsigned int patch_size,
                           KDTree & _kd_tree);
 
@@ -55,7 +56,7 @@ protected:
   const std::vector<dof_id_type> & _trial_master_nodes;
 
   /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const CompressedMap<dof_id_type, dof_id_type> & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
@@ -0,0 +1,84 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADKERNEL_H
+#define ADKERNEL_H
+
+#include "Kernel.h"
+#include "DualNumber.h"
+
+class ADKernel;
+
+template <>
+InputParameters validParams<ADKernel>();
+
+/**
+ * Base class for kernels whose Jacobian is computed by forward mode automatic differentiation.
+ * Derived classes implement computeQpADResidual() in terms of the dual number solution fields
+ * (_ad_u, _ad_grad_u, adCoupledValue(), AD material properties) and the exact Jacobian,
+ * including the off-diagonal blocks of all variables the residual depends on, is assembled from
+ * the derivatives.
+ */
+class ADKernel : public Kernel
+{
+public:
+  ADKernel(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+
+  virtual void computeJacobian() override;
+
+  virtual void computeOffDiagJacobian(MooseVariableFE & jvar) override;
+
+  using Kernel::computeOffDiagJacobian;
+
+protected:
+  /// Compute the residual at the current quadrature point for test function _i
+  virtual ADReal computeQpADResidual() = 0;
+
+  /// Not used by AD kernels, the residual is obtained from computeQpADResidual()
+  virtual Real computeQpResidual() override final;
+
+  ///@{ Dual number values and gradients of a coupled variable
+  const ADVariableValue & adCoupledValue(const std::string & var_name, unsigned int comp = 0);
+  const ADVariableGradient & adCoupledGradient(const std::string & var_name,
+                                               unsigned int comp = 0);
+  ///@}
+
+  /// Dual number solution at the quadrature points
+  ADVariableValue _ad_u;
+
+  /// Dual number solution gradient at the quadrature points
+  ADVariableGradient _ad_grad_u;
+
+private:
+  /// Evaluate the residuals of all test functions as dual numbers
+  void computeADResiduals();
+
+  /// Add the diagonal of the Jacobian block of _var to the diag_save_in variables
+  void saveDiagonal();
+
+  /// Storage for the dual number fields of an AD-coupled variable
+  struct ADCoupledField
+  {
+    MooseVariable * var;
+    ADVariableValue value;
+    ADVariableGradient gradient;
+  };
+
+  ADCoupledField & adCoupledField(const std::string & var_name, unsigned int comp);
+
+  /// AD-coupled variables (other than _var), indexed by variable number
+  std::map<unsigned int, std::unique_ptr<ADCoupledField>> _ad_coupled;
+
+  /// Dual number residuals, one per test function
+  std::vector<ADReal> _ad_residuals;
+};
+
+#endif /* ADKERNEL_H */
@@ -35,6 +35,8 @@ public:
 protected:
   virtual Real computeQpResidual() override;
 
+  virtual void computeResidualAtQps(std::vector<Real> & f, std::vector<RealGradient> & F) override;
+
   /// Scale factor
   const Real & _scale;
 
@@ -30,6 +30,10 @@ protected:
   virtual Real computeQpResidual() override;
 
   virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualAtQps(std::vector<Real> & f, std::vector<RealGradient> & F) override;
+
+  virtual void computeJacobianAtQps(std::vector<Real> & a, std::vector<Real> & d) override;
 };
 
 #endif /* DIFFUSION_H */
@@ -13,6 +13,8 @@
 #include "KernelBase.h"
 #include "MooseVariableInterface.h"
 
+#include <typeinfo>
+
 class Kernel;
 
 template <>
@@ -46,6 +48,39 @@ public:
   virtual MooseVariable & variable() override { return _var; }
 
 protected:
+  /**
+   * Batched counterpart of computeQpResidual(). Kernels with a weak form of
+   * (test, f) + (grad_test, F) fill f and/or F for all quadrature points of the current
+   * element in a single call. A vector that is left empty is skipped by the contraction.
+   * @param f Integrand multiplying the test function, indexed by qp
+   * @param F Integrand multiplying the test function gradient, indexed by qp
+   */
+  virtual void computeResidualAtQps(std::vector<Real> & /*f*/, std::vector<RealGradient> & /*F*/) {}
+
+  /**
+   * Batched counterpart of computeQpJacobian() for on-diagonal blocks of the form
+   * (test, a phi) + (grad_test, d grad_phi). A vector that is left empty is skipped.
+   * @param a Coefficient of the mass-like term, indexed by qp
+   * @param d Coefficient of the stiffness-like term, indexed by qp
+   */
+  virtual void computeJacobianAtQps(std::vector<Real> & /*a*/, std::vector<Real> & /*d*/) {}
+
+  /**
+   * Opt in to the batched quadrature point path. The opt-in only applies if the most derived
+   * type of this object is \p owner, so that classes deriving from a batched kernel and
+   * overriding the per-qp methods keep the per-qp path.
+   */
+  void enableQpBatching(const std::type_info & owner) { _qp_batch_owner = &owner; }
+
+  /// Whether the batched quadrature point path is used for this object
+  bool useQpBatching() const { return _qp_batch_owner && *_qp_batch_owner == typeid(*this); }
+
+  /// Form _local_re from the integrands returned by computeResidualAtQps()
+  void contractResidualAtQps();
+
+  /// Form _local_ke from the coefficients returned by computeJacobianAtQps()
+  void contractJacobianAtQps();
+
   /// This is a regular kernel so we cast to a regular MooseVariable
   MooseVariable & _var;
 
@@ -72,6 +107,18 @@ protected:
 
   /// Derivative of u_dot with respect to u
   const VariableValue & _du_dot_du;
+
+private:
+  /// Type that enabled batched quadrature point evaluation (nullptr if disabled)
+  const std::type_info * _qp_batch_owner;
+
+  /// Scratch storage for the batched quadrature point path
+  std::vector<Real> _qp_value_coef;
+  std::vector<RealGradient> _qp_grad_coef;
+  std::vector<Real> _qp_jac_value_coef;
+  std::vector<Real> _qp_jac_grad_coef;
+  std::vector<Real> _qp_weighted_phi;
+  std::vector<RealGradient> _qp_weighted_grad_phi;
 };
 
 #endif /* KERNEL_H */
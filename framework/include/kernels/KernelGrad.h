@@ -56,6 +56,9 @@ protected:
   virtual RealGradient precomputeQpJacobian();
 
   virtual Real computeQpResidual() override;
+
+  /// Quadrature point values pulled back to the reference element, used for sum factorization
+  std::vector<Real> _tensor_ref_grad;
 };
 
 #endif // KERNELGRAD_H
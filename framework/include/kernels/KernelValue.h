@@ -56,6 +56,9 @@ protected:
   virtual Real precomputeQpJacobian();
 
   virtual Real computeQpResidual() override;
+
+  /// Quadrature point values, used for sum factorization
+  std::vector<Real> _tensor_values;
 };
 
 #endif // KERNELVALUE_H
@@ -11,6 +11,7 @@
 #define COMPUTEJACOBIANTHREAD_H
 
 #include "ThreadedElementLoop.h"
+#include "ObjectProfiler.h"
 
 #include "libmesh/elem_range.h"
 
@@ -44,12 +45,22 @@ public:
 
   void join(const ComputeJacobianThread & /*y*/);
 
+  /**
+   * When set, the elements of the ranges this loop is run on share no nodes with each other
+   * (see MooseMesh::getActiveLocalElementColorRanges()). Element contributions are then added
+   * by each thread right after the element without taking a lock.
+   */
+  void setColored(bool colored) { _colored = colored; }
+
 protected:
   SparseMatrix<Number> & _jacobian;
   NonlinearSystemBase & _nl;
 
   unsigned int _num_cached;
 
+  /// Whether elements of the current range are known not to share any dofs
+  bool _colored;
+
   // Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBCBase> & _integrated_bcs;
 
@@ -64,6 +75,13 @@ protected:
 
   Moose::KernelType _kernel_type;
 
+  /// Per-object timers
+  ObjectProfiler & _profiler;
+  ///@{ Profiler sections of the element and boundary loops
+  const unsigned int _profile_element;
+  const unsigned int _profile_boundary;
+  ///@}
+
   virtual void computeJacobian();
   virtual void computeFaceJacobian(BoundaryID bnd_id);
   virtual void computeInternalFaceJacobian(const Elem * neighbor);
@@ -11,6 +11,7 @@
 #define COMPUTERESIDUALTHREAD_H
 
 #include "ThreadedElementLoop.h"
+#include "ObjectProfiler.h"
 
 #include "libmesh/elem_range.h"
 
@@ -43,11 +44,21 @@ public:
 
   void join(const ComputeResidualThread & /*y*/);
 
+  /**
+   * When set, the elements of the ranges this loop is run on share no nodes with each other
+   * (see MooseMesh::getActiveLocalElementColorRanges()). Element contributions are then added
+   * by each thread right after the element without taking a lock.
+   */
+  void setColored(bool colored) { _colored = colored; }
+
 protected:
   NonlinearSystemBase & _nl;
   Moose::KernelType _kernel_type;
   unsigned int _num_cached;
 
+  /// Whether elements of the current range are known not to share any dofs
+  bool _colored;
+
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBCBase> & _integrated_bcs;
 
@@ -61,6 +72,13 @@ protected:
   /// Reference to Kernel storage structures
   const MooseObjectWarehouse<KernelBase> & _kernels;
   ///@}
+
+  /// Per-object timers
+  ObjectProfiler & _profiler;
+  ///@{ Profiler sections of the element and boundary loops
+  const unsigned int _profile_element;
+  const unsigned int _profile_boundary;
+  ///@}
 };
 
 #endif // COMPUTERESIDUALTHREAD_H
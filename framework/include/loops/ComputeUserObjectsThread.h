@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "ThreadedElementLoop.h"
+#include "ObjectProfiler.h"
 
 #include "libmesh/elem_range.h"
 
@@ -56,6 +57,14 @@ protected:
   const MooseObjectWarehouse<SideUserObject> & _side_user_objects;
   const MooseObjectWarehouse<InternalSideUserObject> & _internal_side_user_objects;
   ///@}
+
+  /// Per-object timers
+  ObjectProfiler & _profiler;
+  ///@{ Profiler sections of the element, boundary and internal side loops
+  const unsigned int _profile_element;
+  const unsigned int _profile_boundary;
+  const unsigned int _profile_internal_side;
+  ///@}
 };
 
 #endif // COMPUTEUSEROBJECTSTHREAD_H
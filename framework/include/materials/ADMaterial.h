@@ -0,0 +1,63 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADMATERIAL_H
+#define ADMATERIAL_H
+
+#include "Material.h"
+#include "DualNumber.h"
+
+class ADMaterial;
+
+template <>
+InputParameters validParams<ADMaterial>();
+
+/**
+ * Base class for materials that compute dual number (ADReal) properties. The coupled variable
+ * fields returned by adCoupledValue() carry derivatives with respect to the element dofs, so that
+ * properties declared with declareADProperty() propagate exact derivatives to ADKernels.
+ * Derivatives are only seeded on element interiors; face and neighbor copies of the material
+ * see the plain variable values.
+ */
+class ADMaterial : public Material
+{
+public:
+  ADMaterial(const InputParameters & parameters);
+
+  virtual void computeProperties() override;
+
+protected:
+  /// Declare a property holding dual numbers
+  MaterialProperty<ADReal> & declareADProperty(const std::string & prop_name)
+  {
+    return declareProperty<ADReal>(prop_name);
+  }
+
+  ///@{ Dual number values and gradients of a coupled variable
+  const ADVariableValue & adCoupledValue(const std::string & var_name, unsigned int comp = 0);
+  const ADVariableGradient & adCoupledGradient(const std::string & var_name,
+                                               unsigned int comp = 0);
+  ///@}
+
+private:
+  /// Storage for the dual number fields of an AD-coupled variable
+  struct ADCoupledField
+  {
+    MooseVariable * var;
+    ADVariableValue value;
+    ADVariableGradient gradient;
+  };
+
+  ADCoupledField & adCoupledField(const std::string & var_name, unsigned int comp);
+
+  /// AD-coupled variables, indexed by variable number
+  std::map<unsigned int, std::unique_ptr<ADCoupledField>> _ad_coupled;
+};
+
+#endif // ADMATERIAL_H
@@ -168,7 +168,30 @@ public:
    */
   virtual void subdomainSetup() override;
 
+  /**
+   * Whether the properties computed by this material only depend on the current element, the
+   * local values of the coupled variables, the properties of other pure materials and time.
+   * The properties of pure materials may be reused instead of being recomputed (see
+   * MaterialPropertyCache).
+   */
+  bool isPure() const { return _pure; }
+
+  /**
+   * Append the inputs of a pure material on the current element (quadrature points and the
+   * values of the coupled variables) to key
+   */
+  void appendPureInputs(std::vector<Real> & key);
+
+  /// The ids of the properties declared by this material
+  const std::set<unsigned int> & getSuppliedPropIDs() const { return _supplied_prop_ids; }
+
 protected:
+  /**
+   * Called in the constructor of materials whose properties are a pure function of their
+   * inputs, see isPure()
+   */
+  void declarePure() { _pure = true; }
+
   /**
    * Evaluate material properties on subdomain
    */
@@ -283,6 +306,9 @@ private:
   bool _has_stateful_property;
 
   bool _overrides_init_stateful_props = true;
+
+  /// Whether this material declared itself pure
+  bool _pure = false;
 };
 
 template <typename T>
@@ -0,0 +1,96 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef MATERIALPROPERTYCACHE_H
+#define MATERIALPROPERTYCACHE_H
+
+#include "MooseTypes.h"
+#include "MaterialProperty.h"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Material;
+
+/**
+ * Keeps the volume material properties computed on every element, so that evaluating the
+ * materials again can be skipped as long as none of their inputs changed, e.g. between the
+ * nonlinear iterations of a solve in regions the solution does not change in.
+ *
+ * This is only done on subdomains where every active material is pure (see
+ * Material::isPure()): the properties are a function of the element, the local values of the
+ * coupled variables and time only. The inputs are compared exactly, so a hit reproduces the
+ * values the materials would have computed.
+ *
+ * One cache is used per thread.
+ */
+class MaterialPropertyCache
+{
+public:
+  MaterialPropertyCache();
+  ~MaterialPropertyCache();
+
+  /**
+   * Copy the properties stored for the current element into props if the materials and their
+   * inputs are the same as when they were stored. If false is returned, the materials have to be
+   * computed and passed to store() afterwards.
+   * @param elem The current element
+   * @param materials The active materials on the subdomain of elem
+   * @param props The current material properties
+   * @param n_points Number of quadrature points of the current element
+   * @param time Current time
+   * @param dt Current time step size (the time derivatives depend on it)
+   * @param computing_jacobian Whether the properties are needed for a Jacobian evaluation,
+   *        which is when automatic differentiation properties carry derivatives
+   */
+  bool restore(const Elem * elem,
+               const std::vector<std::shared_ptr<Material>> & materials,
+               MaterialProperties & props,
+               unsigned int n_points,
+               Real time,
+               Real dt,
+               bool computing_jacobian);
+
+  /**
+   * Store the properties just computed for the element passed to the last restore() call
+   */
+  void store(const MaterialProperties & props, unsigned int n_points);
+
+  /// Drop all stored properties, e.g. after the mesh changed
+  void clear();
+
+  ///@{ Number of restore() calls that could (not) reuse the stored properties
+  unsigned long long hits() const { return _hits; }
+  unsigned long long misses() const { return _misses; }
+  ///@}
+
+protected:
+  struct Entry
+  {
+    /// Inputs of the materials when the properties were stored
+    std::vector<Real> key;
+    /// Stored values, in the order the materials supply them
+    std::vector<PropertyValue *> values;
+  };
+
+  std::unordered_map<dof_id_type, Entry> _entries;
+
+  /// Inputs of the current element
+  std::vector<Real> _key;
+  /// Property ids supplied by the current materials
+  std::vector<unsigned int> _prop_ids;
+  /// Entry of the element passed to the last restore() call
+  Entry * _current_entry;
+
+  unsigned long long _hits;
+  unsigned long long _misses;
+};
+
+#endif // MATERIALPROPERTYCACHE_H
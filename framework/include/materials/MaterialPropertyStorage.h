@@ -105,7 +105,7 @@ public:
                              int input_side = -1);
 
   /**
-   * Initialize stateful material properties
+   * Initialize stateful material properties. Calls from different threads are serialized.
    * @param material_data MaterilData object used for computing the data
    * @param mats Materials that will compute the initial values
    * @param n_qpoints Number of quadrature points
@@ -270,6 +270,9 @@ protected:
 
   void sizeProps(MaterialProperties & mp, unsigned int size);
 
+  /// Serializes initStatefulProps(), the only place two threads may reach the same entry
+  Threads::spin_mutex _init_mutex;
+
 private:
   /// Initializes hashmap entries for element and side to proper qpoint and
   /// property count sizes.
@@ -15,6 +15,7 @@
 #include "BndElement.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "CompressedMap.h"
 
 #include <memory> //std::unique_ptr
 
@@ -70,6 +71,12 @@ public:
 class MooseMesh : public MooseObject, public Restartable
 {
 public:
+  /// Map from node ids to the ids of the elements connected to them
+  typedef CompressedMap<dof_id_type, dof_id_type> NodeToElemMap;
+
+  /// Map from node ids to the ids of the blocks they belong to
+  typedef CompressedMap<dof_id_type, SubdomainID> NodeToBlockMap;
+
   /**
    * Typical "Moose-style" constructor and copy constructor.
    */
@@ -144,7 +151,7 @@ public:
    * If not already created, creates a map from every node to all
    * elements to which they are connected.
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToElemMap();
+  const NodeToElemMap & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -153,7 +160,7 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
+  const NodeToElemMap & nodeToActiveSemilocalElemMap();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -329,6 +336,16 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode *> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *> * getBoundaryElementRange();
 
+  /**
+   * Return the active local elements grouped into colors such that no two elements of the same
+   * color share a node, i.e. they never write to the same degree of freedom. Elements with a
+   * node owned by another processor are left out of the coloring and are returned by
+   * getActiveLocalElementUncoloredRange() instead. The coloring is rebuilt after the mesh
+   * changes.
+   */
+  const std::vector<std::unique_ptr<ConstElemRange>> & getActiveLocalElementColorRanges();
+  ConstElemRange * getActiveLocalElementUncoloredRange();
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -476,9 +493,9 @@ public:
   void printInfo(std::ostream & os = libMesh::out) const;
 
   /**
-   * Return list of blocks to which the given node belongs.
+   * Return list of blocks to which the given node belongs, sorted.
    */
-  const std::set<SubdomainID> & getNodeBlockIds(const Node & node) const;
+  NodeToBlockMap::Values getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -904,12 +921,17 @@ protected:
   std::unique_ptr<StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *>>
       _bnd_elem_range;
 
+  /// Active local elements grouped by color, see getActiveLocalElementColorRanges()
+  std::vector<std::unique_ptr<ConstElemRange>> _active_local_elem_color_ranges;
+  /// Active local elements excluded from the coloring
+  std::unique_ptr<ConstElemRange> _active_local_elem_uncolored_range;
+
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_elem_map;
+  NodeToElemMap _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
+  NodeToElemMap _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
   /**
@@ -936,15 +958,15 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /// Sorted node IDs in each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_node_ids;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
   typedef std::vector<BndElement *>::iterator bnd_elem_iterator_imp;
   typedef std::vector<BndElement *>::const_iterator const_bnd_elem_iterator_imp;
-  /// Map of set of elem IDs connected to each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_elem_ids;
+  /// Sorted elem IDs connected to each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_elem_ids;
 
   std::map<dof_id_type, Node *> _quadrature_nodes;
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *>>>
@@ -952,7 +974,7 @@ protected:
   std::vector<BndNode> _extra_bnd_nodes;
 
   /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID>> _block_node_list;
+  NodeToBlockMap _block_node_list;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type>> _node_set_nodes;
@@ -14,6 +14,8 @@
 #include "SetupInterface.h"
 #include "Restartable.h"
 
+#include <chrono>
+
 class MultiApp;
 class UserObject;
 class FEProblemBase;
@@ -301,6 +303,47 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Give each processor a contiguous range of Apps with about the same total weight.
+   * Requires at least as many Apps as processors.
+   */
+  void balanceApps(const std::vector<Real> & weights);
+
+  /**
+   * Give the backups loaded from a checkpoint to the processors that own their Apps now. When
+   * 'app_timing_file' is provided, the Apps are first rebalanced with the solve times measured
+   * by the run that wrote the checkpoint. This is collective on the MultiApp communicator.
+   */
+  void redistributeBackups();
+
+  /**
+   * Read the App weights from 'app_weights' or 'app_timing_file', if provided. The timing file
+   * is not read when restarting or recovering, redistributeBackups() balances the Apps instead.
+   *
+   * @return The weight of each App, empty if the Apps should be spread evenly
+   */
+  std::vector<Real> readAppWeights();
+
+  /**
+   * Gather the solve time of each App and write them to 'app_timing_file', if provided.
+   * This is collective on the MultiApp communicator.
+   */
+  void writeAppTimings();
+
+  /**
+   * Adds the wall time spent in its scope to the solve time of a local App
+   */
+  class AppSolveTimer
+  {
+  public:
+    AppSolveTimer(MultiApp & multi_app, unsigned int local_app);
+    ~AppSolveTimer();
+
+  private:
+    Real & _time;
+    const std::chrono::steady_clock::time_point _start;
+  };
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -410,8 +453,17 @@ protected:
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
+  /// Whether the backups keep the system vectors in memory instead of serializing them
+  const bool _in_memory_backup;
+
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// The first local App and the number of local Apps of the run that wrote the backups
+  std::pair<unsigned int, unsigned int> & _backup_local_apps;
+
+  /// Wall time spent solving each local App, in seconds
+  std::vector<Real> & _app_solve_times;
 };
 
 template <>
@@ -425,6 +477,10 @@ dataStore(std::ostream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error storing std::vector<Backup*>");
 
+  // The loading processor may own a different number of Apps
+  unsigned int size = backups.size();
+  dataStore(stream, size, nullptr);
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataStore(stream, backups[i], context);
 }
@@ -438,8 +494,16 @@ dataLoad(std::istream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error loading std::vector<Backup*>");
 
+  unsigned int size = 0;
+  dataLoad(stream, size, nullptr);
+  backups.resize(size);
+
   for (unsigned int i = 0; i < backups.size(); i++)
+  {
+    if (!backups[i])
+      backups[i] = std::make_shared<Backup>();
     dataLoad(stream, backups[i], context);
+  }
 
   multi_app->restore();
 }
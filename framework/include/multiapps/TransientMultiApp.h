@@ -53,6 +53,13 @@ public:
    */
   Real computeDT();
 
+protected:
+  /**
+   * Take the next step of the Apps as if it was the first one, e.g. after restoring them to the
+   * state they had before their first step.
+   */
+  void resetFirstStep() { _first = true; }
+
 private:
   /**
    * Setup the executioner for the local app.
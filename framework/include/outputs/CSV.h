@@ -37,6 +37,11 @@ public:
    */
   CSV(const InputParameters & parameters);
 
+  /**
+   * Waits for the background writer, whose tasks use the members of this class
+   */
+  virtual ~CSV();
+
 protected:
   /**
    * Output the table to a *.csv file
@@ -70,6 +75,21 @@ protected:
    */
   virtual void outputVectorPostprocessors() override;
 
+  /**
+   * Write a table to a CSV file, in the background if asynchronous output is enabled.
+   * @param table The table to write
+   * @param file_name The file to write to
+   * @param align Whether to align the columns
+   * @param sort Whether to sort the columns
+   * @param incremental Whether the file is kept open and only the rows added since the last
+   *        call are written (as opposed to writing a new file with the whole table)
+   */
+  void writeTable(FormattedTable & table,
+                  const std::string & file_name,
+                  bool align,
+                  bool sort,
+                  bool incremental);
+
 private:
   /// Flag for aligning data in .csv file
   bool _align;
@@ -91,6 +111,12 @@ private:
 
   /// Flag indicating MOOSE is recovering via --recover command-line option
   bool _recovering;
+
+  /// The incrementally written files the background writer has been handed a table for
+  std::set<std::string> _async_files;
+
+  /// The incrementally written tables, as seen by the background writer (keyed by file name)
+  std::map<std::string, FormattedTable> _async_tables;
 };
 
 #endif /* CSV_H */
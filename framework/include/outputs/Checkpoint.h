@@ -15,6 +15,7 @@
 #include "RestartableDataIO.h"
 
 #include <deque>
+#include <list>
 
 // Forward declarations
 class Checkpoint;
@@ -36,6 +37,9 @@ struct CheckpointFileNames
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Restartable data files of earlier checkpoints referenced by incremental restartable data
+  std::set<std::string> restart_references;
 };
 
 /**
@@ -100,6 +104,9 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// Restartable data files of removed checkpoints, deleted once no checkpoint refers to them
+  std::list<std::string> _unused_restart_files;
 };
 
 #endif // CHECKPOINT_H
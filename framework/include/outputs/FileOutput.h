@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "PetscOutput.h"
+#include "AsyncWriter.h"
 
 // Forward declerations
 class FileOutput;
@@ -65,7 +66,20 @@ public:
    */
   static std::string getOutputFileBase(const MooseApp & app, std::string suffix = "_out");
 
+  /**
+   * Wait until everything queued for writing in the background has been written
+   */
+  void flushAsyncWrites();
+
 protected:
+  /**
+   * Run a task that writes to file on the background writer thread if asynchronous output is
+   * enabled, otherwise run it right away. Tasks run in the order they are queued.
+   *
+   * The task must not touch data that the simulation modifies; hand it a snapshot instead.
+   */
+  void writeAsync(std::function<void()> task);
+
   /**
    * Checks if the output method should be executed
    */
@@ -90,6 +104,12 @@ protected:
   /// Storage for 'output_if_base_contains'
   std::vector<std::string> _output_if_base_contains;
 
+  /**
+   * Background writer used by writeAsync(), nullptr unless created by the derived class.
+   * Derived classes whose tasks use their own members must reset it in their destructor.
+   */
+  std::unique_ptr<AsyncWriter> _async_writer;
+
 private:
   // OutputWarehouse needs access to _file_num for MultiApp ninja wizardry (see
   // OutputWarehouse::merge)
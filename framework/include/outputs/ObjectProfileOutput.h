@@ -0,0 +1,56 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef OBJECTPROFILEOUTPUT_H
+#define OBJECTPROFILEOUTPUT_H
+
+// MOOSE includes
+#include "FileOutput.h"
+
+// Forward declarations
+class ObjectProfileOutput;
+class ObjectProfiler;
+
+template <>
+InputParameters validParams<ObjectProfileOutput>();
+
+/**
+ * Enables the ObjectProfiler of the application and writes the time spent in the individual
+ * Kernels, BCs, Materials and UserObjects as a table, as JSON and as a Chrome trace.
+ */
+class ObjectProfileOutput : public FileOutput
+{
+public:
+  ObjectProfileOutput(const InputParameters & parameters);
+
+  /**
+   * The JSON file name, the trace is written to the same name with a "_trace" suffix
+   */
+  virtual std::string filename() override;
+
+  virtual void output(const ExecFlagType & type) override;
+
+protected:
+  /// The profiler of the application
+  ObjectProfiler & _profiler;
+
+  ///@{ Output toggles
+  const bool _write_screen;
+  const bool _write_json;
+  const bool _write_trace;
+  ///@}
+
+  /// Number of tree levels printed in the screen table
+  const unsigned int _max_depth;
+
+  /// Number of sections printed in the exclusive time summary
+  const unsigned int _max_rows;
+};
+
+#endif /* OBJECTPROFILEOUTPUT_H */
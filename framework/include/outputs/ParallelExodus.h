@@ -0,0 +1,183 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef PARALLELEXODUS_H
+#define PARALLELEXODUS_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+
+#include "libmesh/enum_elem_type.h"
+
+#ifdef LIBMESH_HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <cstdint>
+
+// Forward declarations
+class ParallelExodus;
+
+template <>
+InputParameters validParams<ParallelExodus>();
+
+/**
+ * Writes a single ExodusII file from all processors at once.
+ *
+ * Unlike Exodus, the solution is not serialized to processor 0: every processor writes the
+ * coordinates, connectivity and nodal values of the nodes and elements it owns directly into
+ * the shared file with collective MPI-IO calls. The file uses the NetCDF classic 64-bit offset
+ * format, which can be read by any Exodus reader.
+ *
+ * Nodes are numbered processor by processor, so that each processor writes a contiguous slab of
+ * every nodal field. This is the libMesh numbering when the nodes of each processor have
+ * contiguous ids (e.g. a renumbered DistributedMesh); otherwise a replicated mesh is renumbered
+ * for the output and a distributed mesh is rejected. Elements are numbered block by block, each
+ * processor writing a contiguous slab of each block. Node and side sets are not written.
+ */
+class ParallelExodus : public AdvancedOutput
+{
+public:
+  ParallelExodus(const InputParameters & parameters);
+
+  virtual ~ParallelExodus();
+
+  /**
+   * Starts a new file (with the -s suffix) if the mesh has changed
+   */
+  virtual void meshChanged() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  ///@{ Compute the values of the local nodes and elements
+  virtual void outputNodalVariables() override;
+  virtual void outputElementalVariables() override;
+  ///@}
+
+  ///@{ Collect the global (postprocessor and scalar variable) values
+  virtual void outputPostprocessors() override;
+  virtual void outputScalarVariables() override;
+  ///@}
+
+  /**
+   * Returns the current filename, this method handles the -s000 suffix
+   */
+  virtual std::string filename() override;
+
+  /// Layout of a NetCDF variable in the file
+  struct NetCDFVariable
+  {
+    std::string name;
+    std::vector<unsigned int> dims;
+    /// NetCDF external type (NC_CHAR, NC_INT or NC_DOUBLE)
+    int type;
+    /// Text attributes of the variable
+    std::vector<std::pair<std::string, std::string>> attributes;
+    /// Size in bytes of the variable (of one record for record variables)
+    std::uint64_t size;
+    /// Offset of the variable (of its first record for record variables) in the file
+    std::uint64_t begin;
+    bool record;
+  };
+
+  /**
+   * Number the local nodes and elements, create the file and write the mesh
+   */
+  void initializeFile();
+
+  /**
+   * Close the current file, if any
+   */
+  void closeFile();
+
+  /**
+   * Add a variable to the file layout, returns its index in _variables
+   */
+  unsigned int addVariable(const std::string & name,
+                           const std::vector<unsigned int> & dims,
+                           int type,
+                           bool record);
+
+  /**
+   * Add a dimension to the file layout, returns its id
+   */
+  unsigned int addDimension(const std::string & name, std::uint64_t length);
+
+  /**
+   * Assign the file offsets of the variables and encode the NetCDF header
+   */
+  std::vector<char> buildHeader();
+
+  /// Current output filename; utilized by filename() to create the proper suffix
+  unsigned int _file_num;
+
+  /// Number of records (time steps) in the current file
+  unsigned int _num_records;
+
+  /// Whether the current file has been created
+  bool _file_initialized;
+
+  ///@{ NetCDF layout of the current file
+  std::vector<std::pair<std::string, std::uint64_t>> _dimensions;
+  std::vector<NetCDFVariable> _variables;
+  std::uint64_t _record_size;
+  ///@}
+
+  ///@{ Indices in _variables of the record variables
+  unsigned int _time_var;
+  unsigned int _global_var;
+  std::vector<unsigned int> _nodal_vars;
+  /// Indexed by [elemental variable][block]
+  std::vector<std::vector<unsigned int>> _elemental_vars;
+  ///@}
+
+  /// Ids of the nodes owned by this processor, sorted
+  std::vector<dof_id_type> _local_nodes;
+
+  /// Exodus index (starting at zero) of every node id, empty if it is the node id itself
+  std::vector<dof_id_type> _exodus_node_index;
+
+  /// Exodus index of the first node owned by this processor
+  dof_id_type _first_local_node;
+
+  /// Subdomain ids of the element blocks written to the file
+  std::vector<SubdomainID> _block_ids;
+
+  /// Element type of each block
+  std::vector<ElemType> _block_types;
+
+  /// Local active elements of each block
+  std::vector<std::vector<const Elem *>> _block_elems;
+
+  /// Index (within its block) of the first local element of each block
+  std::vector<dof_id_type> _block_offsets;
+
+  ///@{ Names of the variables in the current file
+  std::vector<std::string> _nodal_names;
+  std::vector<std::string> _elemental_names;
+  std::vector<std::string> _global_names;
+  ///@}
+
+  /// Values of the nodal variables at the local nodes, indexed by [variable][local node]
+  std::vector<std::vector<Real>> _nodal_values;
+
+  /// Values of the elemental variables, indexed by [variable][block][local element]
+  std::vector<std::vector<std::vector<Real>>> _elemental_values;
+
+  /// Global values collected by this output step
+  std::map<std::string, Real> _global_values;
+
+#ifdef LIBMESH_HAVE_MPI
+  /// The shared file handle
+  MPI_File _file;
+#endif
+};
+
+#endif /* PARALLELEXODUS_H */
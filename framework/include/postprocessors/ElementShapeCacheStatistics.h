@@ -0,0 +1,47 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ELEMENTSHAPECACHESTATISTICS_H
+#define ELEMENTSHAPECACHESTATISTICS_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class ElementShapeCacheStatistics;
+
+template <>
+InputParameters validParams<ElementShapeCacheStatistics>();
+
+/**
+ * Reports the hit or miss count of the Assembly element shape function cache (see the
+ * element_shape_cache_size parameter in the Problem block), summed over threads and processors.
+ */
+class ElementShapeCacheStatistics : public GeneralPostprocessor
+{
+public:
+  ElementShapeCacheStatistics(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual Real getValue() override { return _value; }
+
+protected:
+  enum StatisticEnum
+  {
+    HITS,
+    MISSES,
+    HIT_RATIO
+  };
+
+  const StatisticEnum _statistic;
+
+  Real _value;
+};
+
+#endif // ELEMENTSHAPECACHESTATISTICS_H
@@ -34,6 +34,8 @@ public:
   virtual void finalize() override {}
   virtual Real getValue() override;
 
+  virtual void meshChanged() override;
+
 protected:
   /// The variable number of the variable we are operating on
   const unsigned int _var_number;
@@ -46,6 +48,15 @@ protected:
 
   /// The value of the variable at the desired location
   Real _value;
+
+  /// Whether we work on the displaced mesh, where the point is located on every execution
+  const bool _use_displaced_mesh;
+
+  /// Whether _elem is up to date with the mesh
+  bool _point_located;
+
+  /// The element containing the point on this processor (nullptr if there is none)
+  const Elem * _elem;
 };
 
 #endif /* POINTVALUE_H */
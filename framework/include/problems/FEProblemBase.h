@@ -46,6 +46,7 @@ class MeshChangedInterface;
 class MultiMooseEnum;
 class MaterialPropertyStorage;
 class MaterialData;
+class MaterialPropertyCache;
 class MooseEnum;
 class Resurrector;
 class Assembly;
@@ -885,6 +886,32 @@ public:
   virtual void computeJacobian(const NumericVector<Number> & soln,
                                SparseMatrix<Number> & jacobian,
                                Moose::KernelType kernel_type = Moose::KT_ALL);
+
+  /**
+   * Bring the problem into the state the Jacobian is evaluated at (solution, auxiliary
+   * variables, user objects, ...) without computing anything. computeJacobian() does this
+   * itself; matrix-free solves call it once per Newton step and then apply the Jacobian through
+   * computeJacobianProduct().
+   */
+  virtual void prepareJacobian(const NumericVector<Number> & soln);
+
+  /**
+   * Apply the Jacobian at the state set up by prepareJacobian() to a vector, computing the
+   * contributions element by element without assembling a matrix.
+   */
+  virtual void computeJacobianProduct(const NumericVector<Number> & input,
+                                      NumericVector<Number> & product);
+
+  /**
+   * Assemble the diagonal of the Jacobian at the state set up by prepareJacobian()
+   */
+  virtual void computeJacobianDiagonal(NumericVector<Number> & diagonal);
+
+  /**
+   * Make the assembly objects (including the displaced ones) apply Jacobian contributions to a
+   * vector rather than a matrix, see Assembly::setJacobianProduct()
+   */
+  void setJacobianProduct(const NumericVector<Number> * input, NumericVector<Number> * product);
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -1225,6 +1252,13 @@ public:
 
   void setIgnoreZerosInJacobian(bool state) { _ignore_zeros_in_jacobian = state; }
 
+  /**
+   * Whether the element loops of the residual and Jacobian computation run color by color,
+   * with threads adding element contributions without locking.
+   * @see MooseMesh::getActiveLocalElementColorRanges()
+   */
+  bool useAssemblyColoring() const;
+
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
@@ -1434,6 +1468,9 @@ protected:
   /// Cache for calculating materials on side
   std::vector<std::unordered_map<SubdomainID, bool>> _block_mat_side_cache;
 
+  /// Volume material properties kept per element for reuse (one per thread, empty if disabled)
+  std::vector<std::unique_ptr<MaterialPropertyCache>> _material_property_cache;
+
   /// Cache for calculating materials on side
   std::vector<std::unordered_map<BoundaryID, bool>> _bnd_mat_side_cache;
 
@@ -1562,6 +1599,8 @@ protected:
 private:
   bool _error_on_jacobian_nonzero_reallocation;
   bool _ignore_zeros_in_jacobian;
+  const bool _use_assembly_coloring;
+  const bool _cache_pure_materials;
   bool _force_restart;
   bool _skip_additional_restart_data;
   bool _fail_next_linear_convergence_check;
@@ -1572,6 +1611,9 @@ private:
   /// Whether the problem has dgkernels or interface kernels
   bool _has_internal_edge_residual_objects;
 
+  /// ObjectProfiler section timing reinitMaterials()
+  const unsigned int _profile_reinit_materials;
+
   friend class AuxiliarySystem;
   friend class NonlinearSystemBase;
   friend class MooseEigenSystem;
@@ -10,10 +10,20 @@
 #ifndef BACKUP_H
 #define BACKUP_H
 
+#include "libmesh/libmesh_common.h"
+
 // C++ includes
+#include <memory>
 #include <sstream>
 #include <vector>
 
+// libMesh forward declarations
+namespace libMesh
+{
+template <typename T>
+class NumericVector;
+}
+
 /**
  * Helper class to hold streams for Backup and Restore operations.
  */
@@ -24,8 +34,14 @@ public:
 
   ~Backup();
 
+  /// Discard the vectors of an in-memory backup, so that _system_data is used instead
+  void clearSystemVectors();
+
   std::stringstream _system_data;
 
+  /// Copies of the system vectors kept by in-memory backups instead of _system_data
+  std::vector<std::unique_ptr<libMesh::NumericVector<libMesh::Number>>> _system_vectors;
+
   std::vector<std::stringstream *> _restartable_data;
 };
 
@@ -651,7 +651,16 @@ template <>
 inline void
 dataStore(std::ostream & stream, Backup *& backup, void * context)
 {
-  dataStore(stream, backup->_system_data, context);
+  // In-memory backups are written in the layout of the serialized systems
+  if (!backup->_system_vectors.empty())
+  {
+    std::stringstream system_data;
+    for (auto & vector : backup->_system_vectors)
+      dataStore(system_data, *vector, context);
+    dataStore(stream, system_data, context);
+  }
+  else
+    dataStore(stream, backup->_system_data, context);
 
   for (unsigned int i = 0; i < backup->_restartable_data.size(); i++)
     dataStore(stream, backup->_restartable_data[i], context);
@@ -661,6 +670,7 @@ template <>
 inline void
 dataLoad(std::istream & stream, Backup *& backup, void * context)
 {
+  backup->clearSystemVectors();
   dataLoad(stream, backup->_system_data, context);
 
   for (unsigned int i = 0; i < backup->_restartable_data.size(); i++)
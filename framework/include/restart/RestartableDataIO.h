@@ -15,6 +15,7 @@
 #include "RestartableData.h"
 
 // C++ includes
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <list>
@@ -22,6 +23,7 @@
 // Forward declarations
 class Backup;
 class FEProblemBase;
+class SystemBase;
 
 /**
  * Class for doing restart.
@@ -35,6 +37,25 @@ public:
 
   virtual ~RestartableDataIO() = default;
 
+  /**
+   * Write the restartable data files in the chunked format: the data is split into chunks that
+   * are compressed and/or, for incremental files, replaced by a reference to the file of an
+   * earlier write that holds an identical chunk.
+   * @param compress Compress the chunks (requires zlib)
+   * @param incremental Only write the chunks that changed since the previous write
+   * @param chunk_size Size of the chunks in bytes
+   * @param full_interval Number of incremental writes after which all chunks are written again
+   */
+  void setChunkedOutput(bool compress,
+                        bool incremental,
+                        std::size_t chunk_size,
+                        unsigned int full_interval);
+
+  /**
+   * The files of earlier writes that hold chunks referenced by the last written files
+   */
+  const std::set<std::string> & referencedFiles() const { return _referenced_files; }
+
   /**
    * Write out the restartable data.
    */
@@ -59,6 +80,13 @@ public:
    */
   std::shared_ptr<Backup> createBackup();
 
+  /**
+   * Store the current system in an existing Backup, keeping copies of the system vectors in
+   * memory instead of serializing them. The copies made by an earlier call are reused, so that
+   * taking a snapshot is a vector copy.
+   */
+  void createSnapshot(Backup & backup);
+
   /**
    * Restore a Backup for the current system.
    */
@@ -72,6 +100,21 @@ private:
       const std::map<std::string, std::unique_ptr<RestartableDataValue>> & restartable_data,
       std::ostream & stream);
 
+  /**
+   * Writes the data of one thread to a file in the chunked format.
+   */
+  void writeChunkedRestartableData(
+      const std::string & file_name,
+      const std::map<std::string, std::unique_ptr<RestartableDataValue>> & restartable_data,
+      THREAD_ID tid,
+      bool full);
+
+  /**
+   * Reads a chunked file (following its header) and writes the data into the stream in the
+   * layout deserializeRestartableData() expects.
+   */
+  void readChunkedRestartableData(THREAD_ID tid, std::ostream & stream);
+
   /**
    * Deserializes the data from the stream object.
    */
@@ -90,11 +133,51 @@ private:
    */
   void deserializeSystems(std::istream & stream);
 
+  /**
+   * The Systems in FEProblemBase whose vectors are backed up, in the order they are serialized
+   */
+  std::vector<SystemBase *> backupSystems();
+
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
   /// A vector of file handles, one per thread
   std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
+
+  /// Names and format versions of the files opened by readRestartableDataHeader()
+  std::vector<std::string> _in_file_names;
+  std::vector<unsigned int> _in_file_versions;
+
+  ///@{ Settings of the chunked format
+  bool _chunked;
+  bool _compress;
+  bool _incremental;
+  std::size_t _chunk_size;
+  unsigned int _full_interval;
+  ///@}
+
+  /// Number of incremental writes since all chunks were last written
+  unsigned int _num_incremental;
+
+  /// Where a chunk of restartable data is stored
+  struct ChunkLocation
+  {
+    /// Hash and size of the uncompressed chunk
+    std::uint64_t hash;
+    std::uint32_t size;
+    /// Whether the chunk is compressed
+    bool compressed;
+    /// File, offset and size of the stored chunk
+    std::string file;
+    std::uint64_t offset;
+    std::uint32_t stored_size;
+  };
+
+  /// The chunks of the last written files, indexed by [tid][data name]
+  std::vector<std::map<std::string, std::vector<ChunkLocation>>> _last_chunks;
+
+  /// Files of earlier writes referenced by the last written files
+  std::set<std::string> _referenced_files;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
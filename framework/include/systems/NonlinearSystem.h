@@ -93,7 +93,20 @@ private:
    */
   void setupColoringFiniteDifferencedPreconditioner();
 
+  /**
+   * Hand PETSc a shell matrix as the Jacobian for MATRIX_FREE solves. Its products and diagonal
+   * are computed element by element (see NonlinearSystemBase::computeJacobianProduct()), so the
+   * Jacobian is never stored.
+   */
+  void setupMatrixFreeJacobian();
+
   bool _use_coloring_finite_difference;
+
+  /// Whether _matrix_free_jacobian has been created for the current solve
+  bool _use_matrix_free_jacobian;
+#ifdef LIBMESH_HAVE_PETSC
+  Mat _matrix_free_jacobian;
+#endif
 };
 
 #endif /* NONLINEARSYSTEM_H */
@@ -14,6 +14,7 @@
 #include "ConstraintWarehouse.h"
 #include "MooseObjectWarehouse.h"
 
+#include "libmesh/elem_range.h"
 #include "libmesh/transient_system.h"
 #include "libmesh/nonlinear_implicit_system.h"
 
@@ -274,6 +275,24 @@ public:
   void computeJacobian(SparseMatrix<Number> & jacobian,
                        Moose::KernelType kernel_type = Moose::KT_ALL);
 
+  /**
+   * Applies the Jacobian to a vector without assembling it. The contributions of all objects
+   * are computed exactly as in computeJacobian(), but multiplied with the input right away, so
+   * no global matrix has to be stored.
+   * @param input The vector the Jacobian is applied to
+   * @param product The product of the Jacobian and input is formed in here
+   */
+  void computeJacobianProduct(const NumericVector<Number> & input,
+                              NumericVector<Number> & product,
+                              Moose::KernelType kernel_type = Moose::KT_ALL);
+
+  /**
+   * Computes the diagonal of the Jacobian without assembling it
+   * @param diagonal The diagonal is formed in here
+   */
+  void computeJacobianDiagonal(NumericVector<Number> & diagonal,
+                               Moose::KernelType kernel_type = Moose::KT_ALL);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -569,6 +588,25 @@ protected:
 
   void computeJacobianInternal(SparseMatrix<Number> & jacobian, Moose::KernelType kernel_type);
 
+  /**
+   * Run computeJacobianInternal() with all Jacobian contributions redirected to a vector
+   * @param input Ghosted vector the Jacobian is applied to, nullptr to compute the diagonal
+   * @param product Receives the product (or diagonal)
+   */
+  void computeJacobianProductInternal(const NumericVector<Number> * input,
+                                      NumericVector<Number> & product,
+                                      Moose::KernelType kernel_type);
+
+  /// Close the Jacobian, or the product vector if a Jacobian product is being computed
+  void closeJacobian(SparseMatrix<Number> & jacobian);
+
+  /**
+   * Run the element loop of a Jacobian computation, color by color if assembly coloring is
+   * enabled (see FEProblemBase::useAssemblyColoring())
+   */
+  template <typename JacobianThread>
+  void computeJacobianElements(ConstElemRange & elem_range, JacobianThread & cj);
+
   void computeDiracContributions(SparseMatrix<Number> * jacobian = NULL);
 
   void computeScalarKernelsJacobians(SparseMatrix<Number> & jacobian);
@@ -604,6 +642,15 @@ protected:
   /// residual vector for non-time contributions
   NumericVector<Number> * _Re_non_time;
 
+  /// Ghosted copy of the vector the Jacobian is applied to in matrix-free products
+  NumericVector<Number> * _jacobian_product_input;
+  /// Input copy that also ghosts the dofs read by nonlocal kernels and boundary conditions
+  std::unique_ptr<NumericVector<Number>> _jacobian_product_nonlocal_input;
+  /// Vector receiving the Jacobian contributions in place of the matrix, nullptr when assembling
+  NumericVector<Number> * _jacobian_product;
+  /// Never initialized matrix handed to the Jacobian routines while computing products
+  std::unique_ptr<SparseMatrix<Number>> _jacobian_product_matrix;
+
   ///@{
   /// Kernel Storage
   MooseObjectWarehouse<KernelBase> _kernels;
@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -53,21 +54,54 @@ protected:
   Real bboxMaxDistance(Point p, BoundingBox bbox);
 
   /**
-   * Return the distance between the given point and the nearest corner of the
-   * given bounding box.
-   * @param p The point to evaluate all distances from.
+   * Return the distance between the given point and the given bounding box.
+   * @param p The point to evaluate the distance from.
    * @param bbox The bounding box to evaluate the distance to.
-   * @return The minimum distance between the point p and the eight corners of
-   * the bounding box bbox.
+   * @return The minimum distance between the point p and any point in the
+   * bounding box bbox (zero if p lies inside the box).
    */
   Real bboxMinDistance(Point p, BoundingBox bbox);
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
+  /**
+   * Gather the local nodes of a "from" domain that carry a dof of the source variable.
+   * @param i_from The index of the (local) "from" domain
+   * @param points The node positions, relative to the domain's position
+   * @param dofs The dof of the source variable at each node
+   */
+  void getLocalSourceNodes(unsigned int i_from,
+                           std::vector<Point> & points,
+                           std::vector<dof_id_type> & dofs);
+
+  /**
+   * Gather the local nodes (or element centroids for elemental variables) of a "to" domain that
+   * carry a dof of the target variable.
+   * @param i_to The index of the "to" domain
+   * @param points The positions, including the domain's position
+   * @param dofs The dof of the target variable at each point
+   */
+  void
+  getLocalTargets(unsigned int i_to, std::vector<Point> & points, std::vector<dof_id_type> & dofs);
+
+  /**
+   * Search the source nodes of a local "from" domain for a node that is closer to p than the
+   * given distance. Nodes at the same distance are resolved in favor of the node gathered first.
+   * @param i_from The index of the (local) "from" domain
+   * @param p The point, including the domain's position
+   * @param distance The distance to beat on input, the distance to the node found on output
+   * @param index The index of the node found in _source_points[i_from]
+   * @return Whether a closer node was found
+   */
+  bool findNearestSourceNode(unsigned int i_from,
+                             const Point & p,
+                             Real & distance,
+                             unsigned int & index);
+
   AuxVariableName _to_var_name;
   VariableName _from_var_name;
 
-  /// If true then node connections will be cached
+  /// If true then the cached node connections are reused without checking for mesh changes
   bool _fixed_meshes;
 
   /// Used to cache nodes
@@ -80,8 +114,26 @@ protected:
   bool & _neighbors_cached;
   std::vector<std::vector<unsigned int>> & _cached_froms;
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
-  std::map<dof_id_type, unsigned int> & _cached_from_inds;
-  std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+  std::vector<std::vector<unsigned int>> & _cached_from_inds;
+  std::vector<std::vector<unsigned int>> & _cached_qp_inds;
+
+  /// Source node positions and dofs for each local "from" domain, as of the last search
+  std::vector<std::vector<Point>> _source_points;
+  std::vector<std::vector<dof_id_type>> _source_dofs;
+  std::vector<Point> _source_positions;
+
+  /// KD-trees over _source_points (nullptr for domains without source nodes)
+  std::vector<std::unique_ptr<KDTree>> _source_kd_trees;
+
+  /// Target positions and dofs for each "to" domain, as of the last search
+  std::vector<std::vector<Point>> _target_points;
+  std::vector<std::vector<dof_id_type>> _target_dofs;
+
+  ///@{ Scratch space for the KD-tree searches
+  std::vector<std::size_t> _knn_index;
+  std::vector<Real> _knn_dist_sqr;
+  std::vector<std::pair<std::size_t, Real>> _radius_results;
+  ///@}
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
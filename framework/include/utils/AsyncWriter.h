@@ -0,0 +1,82 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ASYNCWRITER_H
+#define ASYNCWRITER_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * Runs file writing tasks on a background thread, in the order they were queued.
+ *
+ * The tasks must only touch data that the queuing thread leaves alone until they have run,
+ * typically a snapshot of the data to write. The queue is bounded: push() blocks while it
+ * is full, so that a slow file system throttles the simulation instead of letting the
+ * snapshots pile up in memory.
+ *
+ * An exception thrown by a task is rethrown on the queuing thread by the next push() or
+ * flush().
+ */
+class AsyncWriter
+{
+public:
+  /**
+   * @param max_queued Maximum number of tasks waiting to be run (at least one)
+   */
+  AsyncWriter(unsigned int max_queued);
+
+  /// Runs the remaining tasks and stops the thread
+  ~AsyncWriter();
+
+  AsyncWriter(const AsyncWriter &) = delete;
+  AsyncWriter & operator=(const AsyncWriter &) = delete;
+
+  /// Queue a task, waiting for room in the queue if necessary
+  void push(std::function<void()> task);
+
+  /// Wait until all queued tasks have run
+  void flush();
+
+protected:
+  /// The loop run by the background thread
+  void run();
+
+  /// Rethrow the exception of a failed task, if any (requires _mutex to be locked)
+  void rethrow();
+
+  const unsigned int _max_queued;
+
+  std::deque<std::function<void()>> _queue;
+
+  /// Whether the background thread is running a task
+  bool _busy;
+
+  /// Set to stop the background thread once the queue is empty
+  bool _stop;
+
+  /// The exception thrown by a failed task
+  std::exception_ptr _error;
+
+  std::mutex _mutex;
+
+  /// Signaled when a task is queued or the thread should stop
+  std::condition_variable _task_queued;
+
+  /// Signaled when a task has run
+  std::condition_variable _task_done;
+
+  std::thread _thread;
+};
+
+#endif // ASYNCWRITER_H
@@ -0,0 +1,247 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPRESSEDMAP_H
+#define COMPRESSEDMAP_H
+
+#include "MooseError.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * A read-mostly map from keys to lists of values, stored in compressed rows: the sorted keys in
+ * one array, the values of all the keys one after the other in a second array, and the offset of
+ * the values of each key in a third. The position of a key in the first array is its dense local
+ * number. A lookup is a binary search through contiguous memory instead of a walk down the nodes
+ * of a std::map, and there is no per-key allocation.
+ *
+ * Keys that are added after the map was built (e.g. quadrature nodes) are kept in a std::map on
+ * the side.
+ *
+ * The map can be used where a const std::map<Key, std::vector<T>> was used before: it is iterated
+ * in key order, and find(), count() and at() behave the same. The values of a key can be
+ * iterated, searched, and converted to a std::vector or a std::set.
+ */
+template <typename Key, typename T>
+class CompressedMap
+{
+public:
+  /**
+   * The values of a key, a contiguous range that stays valid until the map is modified
+   */
+  class Values
+  {
+  public:
+    Values() : _begin(nullptr), _end(nullptr) {}
+    Values(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+    const T * begin() const { return _begin; }
+    const T * end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const T & operator[](std::size_t i) const { return _begin[i]; }
+
+    ///@{ Set-like access, a linear search since a key only has a few values
+    const T * find(const T & value) const { return std::find(_begin, _end, value); }
+    std::size_t count(const T & value) const { return std::count(_begin, _end, value); }
+    ///@}
+
+    ///@{ Copies of the values, for code that expects the containers the map used to hold
+    operator std::vector<T>() const { return std::vector<T>(_begin, _end); }
+    operator std::set<T>() const { return std::set<T>(_begin, _end); }
+    ///@}
+
+  private:
+    const T * _begin;
+    const T * _end;
+  };
+
+  typedef std::pair<Key, Values> value_type;
+
+  typedef typename std::map<Key, std::vector<T>>::const_iterator extra_iterator;
+
+  /**
+   * Forward iterator over the keys in ascending order, dereferences to a (key, values) pair like
+   * a std::map iterator. The compressed keys and the keys added later are merged on the fly.
+   */
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename CompressedMap::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const value_type * pointer;
+    typedef const value_type & reference;
+
+    const_iterator() : _map(nullptr), _index(0) {}
+
+    const value_type & operator*() const { return _value; }
+    const value_type * operator->() const { return &_value; }
+
+    const_iterator & operator++()
+    {
+      if (onExtra())
+        ++_extra;
+      else
+        ++_index;
+      update();
+      return *this;
+    }
+
+    const_iterator operator++(int)
+    {
+      const_iterator old = *this;
+      ++(*this);
+      return old;
+    }
+
+    bool operator==(const const_iterator & other) const
+    {
+      return _index == other._index && _extra == other._extra;
+    }
+    bool operator!=(const const_iterator & other) const { return !(*this == other); }
+
+  private:
+    friend class CompressedMap;
+
+    /**
+     * @param index Position in the compressed keys
+     * @param extra Position in the keys added later
+     */
+    const_iterator(const CompressedMap & map, std::size_t index, extra_iterator extra)
+      : _map(&map), _index(index), _extra(extra)
+    {
+      update();
+    }
+
+    /// Whether the current key is one of the keys added later
+    bool onExtra() const
+    {
+      return _extra != _map->_extra_values.end() &&
+             (_index == _map->_keys.size() || _extra->first < _map->_keys[_index]);
+    }
+
+    void update()
+    {
+      if (onExtra())
+        _value = value_type(
+            _extra->first,
+            Values(_extra->second.data(), _extra->second.data() + _extra->second.size()));
+      else if (_index < _map->_keys.size())
+        _value = value_type(_map->_keys[_index], _map->values(_index));
+    }
+
+    const CompressedMap * _map;
+    std::size_t _index;
+    extra_iterator _extra;
+    value_type _value;
+  };
+
+  /**
+   * Replace the compressed rows of the map, the keys added with insert() are kept.
+   * @param entries (key, value) pairs sorted by key, the values of a key keep this order
+   */
+  void build(const std::vector<std::pair<Key, T>> & entries)
+  {
+    _keys.clear();
+    _offsets.clear();
+    _values.clear();
+
+    _values.reserve(entries.size());
+    for (const auto & entry : entries)
+    {
+      if (_keys.empty() || _keys.back() != entry.first)
+      {
+        mooseAssert(_keys.empty() || _keys.back() < entry.first, "Entries must be sorted by key");
+        _keys.push_back(entry.first);
+        _offsets.push_back(_values.size());
+      }
+      _values.push_back(entry.second);
+    }
+    _offsets.push_back(_values.size());
+
+    _keys.shrink_to_fit();
+    _offsets.shrink_to_fit();
+  }
+
+  /**
+   * Append a value to a key that is not part of the compressed rows
+   */
+  void insert(const Key & key, const T & value)
+  {
+    mooseAssert(!std::binary_search(_keys.begin(), _keys.end(), key),
+                "Values cannot be added to the compressed keys");
+    _extra_values[key].push_back(value);
+  }
+
+  const_iterator find(const Key & key) const
+  {
+    const std::size_t i = std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin();
+    const auto extra_it = _extra_values.lower_bound(key);
+    if ((i < _keys.size() && _keys[i] == key) ||
+        (extra_it != _extra_values.end() && extra_it->first == key))
+      return const_iterator(*this, i, extra_it);
+
+    return end();
+  }
+
+  std::size_t count(const Key & key) const { return find(key) != end(); }
+
+  /// The values of a key, throws std::out_of_range if the key is not in the map
+  Values at(const Key & key) const
+  {
+    const auto it = find(key);
+    if (it == end())
+      throw std::out_of_range("CompressedMap::at");
+    return it->second;
+  }
+
+  const_iterator begin() const { return const_iterator(*this, 0, _extra_values.begin()); }
+  const_iterator end() const { return const_iterator(*this, _keys.size(), _extra_values.end()); }
+
+  /// The number of keys
+  std::size_t size() const { return _keys.size() + _extra_values.size(); }
+
+  bool empty() const { return size() == 0; }
+
+  void clear()
+  {
+    _keys.clear();
+    _offsets.clear();
+    _values.clear();
+    _extra_values.clear();
+  }
+
+protected:
+  /// The values of the compressed key _keys[i]
+  Values values(std::size_t i) const
+  {
+    return Values(_values.data() + _offsets[i], _values.data() + _offsets[i + 1]);
+  }
+
+  /// The sorted keys
+  std::vector<Key> _keys;
+
+  /// The values of _keys[i] are _values[_offsets[i]] to _values[_offsets[i + 1] - 1]
+  std::vector<std::size_t> _offsets;
+
+  std::vector<T> _values;
+
+  /// Keys added after the map was built
+  std::map<Key, std::vector<T>> _extra_values;
+};
+
+#endif // COMPRESSEDMAP_H
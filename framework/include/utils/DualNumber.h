@@ -0,0 +1,305 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef DUALNUMBER_H
+#define DUALNUMBER_H
+
+#include "MooseArray.h"
+
+#include "libmesh/libmesh_common.h"
+#include "libmesh/compare_types.h"
+#include "libmesh/vector_value.h"
+
+#include <array>
+#include <cmath>
+
+/**
+ * Maximum number of element degrees of freedom (summed over all coupled variables) that a
+ * DualNumber carries derivatives for. Can be overridden at compile time, e.g.
+ * -DMOOSE_AD_MAX_DOFS_PER_ELEM=100 for multi-physics problems on second order hexes.
+ */
+#ifndef MOOSE_AD_MAX_DOFS_PER_ELEM
+#define MOOSE_AD_MAX_DOFS_PER_ELEM 64
+#endif
+
+/**
+ * Forward mode automatic differentiation scalar. Holds a value and a fixed size, stack allocated
+ * array of partial derivatives with respect to the local degrees of freedom of the current
+ * element. The class is trivially copyable so that it can be stored in MooseArrays and stateful
+ * material properties without special handling.
+ */
+template <typename T, unsigned int N>
+class DualNumber
+{
+public:
+  typedef std::array<T, N> DerivativeType;
+
+  DualNumber() : _value(0) { _derivatives.fill(0); }
+
+  DualNumber(const T & value) : _value(value) { _derivatives.fill(0); }
+
+  DualNumber(const T & value, const DerivativeType & derivatives)
+    : _value(value), _derivatives(derivatives)
+  {
+  }
+
+  ///@{ Value and derivative accessors
+  T & value() { return _value; }
+  const T & value() const { return _value; }
+  DerivativeType & derivatives() { return _derivatives; }
+  const DerivativeType & derivatives() const { return _derivatives; }
+  ///@}
+
+  /// Number of derivative slots carried by every instance
+  static constexpr unsigned int size() { return N; }
+
+  DualNumber & operator+=(const DualNumber & rhs)
+  {
+    _value += rhs._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] += rhs._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator-=(const DualNumber & rhs)
+  {
+    _value -= rhs._value;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] -= rhs._derivatives[i];
+    return *this;
+  }
+
+  DualNumber & operator*=(const DualNumber & rhs)
+  {
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = _derivatives[i] * rhs._value + _value * rhs._derivatives[i];
+    _value *= rhs._value;
+    return *this;
+  }
+
+  DualNumber & operator/=(const DualNumber & rhs)
+  {
+    const T inv = 1.0 / rhs._value;
+    _value *= inv;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] = (_derivatives[i] - _value * rhs._derivatives[i]) * inv;
+    return *this;
+  }
+
+  DualNumber & operator+=(const T & rhs)
+  {
+    _value += rhs;
+    return *this;
+  }
+
+  DualNumber & operator-=(const T & rhs)
+  {
+    _value -= rhs;
+    return *this;
+  }
+
+  DualNumber & operator*=(const T & rhs)
+  {
+    _value *= rhs;
+    for (unsigned int i = 0; i < N; ++i)
+      _derivatives[i] *= rhs;
+    return *this;
+  }
+
+  DualNumber & operator/=(const T & rhs) { return *this *= (1.0 / rhs); }
+
+  DualNumber operator-() const
+  {
+    DualNumber ret(*this);
+    ret *= -1.0;
+    return ret;
+  }
+
+  DualNumber operator+() const { return *this; }
+
+  ///@{ Arithmetic, defined as friends so that implicit conversions from T apply
+  friend DualNumber operator+(DualNumber a, const DualNumber & b) { return a += b; }
+  friend DualNumber operator+(DualNumber a, const T & b) { return a += b; }
+  friend DualNumber operator+(const T & a, DualNumber b) { return b += a; }
+
+  friend DualNumber operator-(DualNumber a, const DualNumber & b) { return a -= b; }
+  friend DualNumber operator-(DualNumber a, const T & b) { return a -= b; }
+  friend DualNumber operator-(const T & a, const DualNumber & b) { return -b + a; }
+
+  friend DualNumber operator*(DualNumber a, const DualNumber & b) { return a *= b; }
+  friend DualNumber operator*(DualNumber a, const T & b) { return a *= b; }
+  friend DualNumber operator*(const T & a, DualNumber b) { return b *= a; }
+
+  friend DualNumber operator/(DualNumber a, const DualNumber & b) { return a /= b; }
+  friend DualNumber operator/(DualNumber a, const T & b) { return a /= b; }
+  friend DualNumber operator/(const T & a, const DualNumber & b) { return DualNumber(a) /= b; }
+  ///@}
+
+  ///@{ Comparisons only look at the value
+  friend bool operator<(const DualNumber & a, const DualNumber & b) { return a._value < b._value; }
+  friend bool operator<(const DualNumber & a, const T & b) { return a._value < b; }
+  friend bool operator<(const T & a, const DualNumber & b) { return a < b._value; }
+  friend bool operator>(const DualNumber & a, const DualNumber & b) { return a._value > b._value; }
+  friend bool operator>(const DualNumber & a, const T & b) { return a._value > b; }
+  friend bool operator>(const T & a, const DualNumber & b) { return a > b._value; }
+  friend bool operator<=(const DualNumber & a, const DualNumber & b) { return !(a > b); }
+  friend bool operator<=(const DualNumber & a, const T & b) { return !(a > b); }
+  friend bool operator<=(const T & a, const DualNumber & b) { return !(a > b); }
+  friend bool operator>=(const DualNumber & a, const DualNumber & b) { return !(a < b); }
+  friend bool operator>=(const DualNumber & a, const T & b) { return !(a < b); }
+  friend bool operator>=(const T & a, const DualNumber & b) { return !(a < b); }
+  friend bool operator==(const DualNumber & a, const DualNumber & b) { return a._value == b._value; }
+  friend bool operator==(const DualNumber & a, const T & b) { return a._value == b; }
+  friend bool operator==(const T & a, const DualNumber & b) { return a == b._value; }
+  friend bool operator!=(const DualNumber & a, const DualNumber & b) { return !(a == b); }
+  friend bool operator!=(const DualNumber & a, const T & b) { return !(a == b); }
+  friend bool operator!=(const T & a, const DualNumber & b) { return !(a == b); }
+  ///@}
+
+  /**
+   * Apply the chain rule for a function f of this number, given f(value) and f'(value)
+   */
+  DualNumber chain(const T & f, const T & df) const
+  {
+    DualNumber ret(f);
+    for (unsigned int i = 0; i < N; ++i)
+      ret._derivatives[i] = df * _derivatives[i];
+    return ret;
+  }
+
+private:
+  T _value;
+  DerivativeType _derivatives;
+};
+
+/**
+ * Elementary functions of dual numbers. They are declared next to DualNumber and found by argument
+ * dependent lookup, so code that should work for both Real and dual numbers calls them unqualified
+ * after a using-declaration of the std:: version (e.g. "using std::sqrt; sqrt(x)"). Adding
+ * overloads to namespace std is not allowed.
+ */
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+sqrt(const DualNumber<T, N> & a)
+{
+  const T s = std::sqrt(a.value());
+  return a.chain(s, 0.5 / s);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+exp(const DualNumber<T, N> & a)
+{
+  const T e = std::exp(a.value());
+  return a.chain(e, e);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+log(const DualNumber<T, N> & a)
+{
+  return a.chain(std::log(a.value()), 1.0 / a.value());
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+sin(const DualNumber<T, N> & a)
+{
+  return a.chain(std::sin(a.value()), std::cos(a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+cos(const DualNumber<T, N> & a)
+{
+  return a.chain(std::cos(a.value()), -std::sin(a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+tan(const DualNumber<T, N> & a)
+{
+  const T t = std::tan(a.value());
+  return a.chain(t, 1.0 + t * t);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+tanh(const DualNumber<T, N> & a)
+{
+  const T t = std::tanh(a.value());
+  return a.chain(t, 1.0 - t * t);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+atan(const DualNumber<T, N> & a)
+{
+  return a.chain(std::atan(a.value()), 1.0 / (1.0 + a.value() * a.value()));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+abs(const DualNumber<T, N> & a)
+{
+  return a.value() < 0 ? -a : a;
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+pow(const DualNumber<T, N> & a, const T & b)
+{
+  const T p = std::pow(a.value(), b - 1);
+  return a.chain(p * a.value(), b * p);
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+pow(const DualNumber<T, N> & a, int b)
+{
+  return pow(a, T(b));
+}
+
+template <typename T, unsigned int N>
+inline DualNumber<T, N>
+pow(const DualNumber<T, N> & a, const DualNumber<T, N> & b)
+{
+  return exp(b * log(a));
+}
+
+namespace libMesh
+{
+/// Allow DualNumbers as the scalar type of libMesh vectors and tensors
+template <typename T, unsigned int N>
+struct ScalarTraits<DualNumber<T, N>>
+{
+  static const bool value = true;
+};
+
+template <unsigned int N>
+struct CompareTypes<DualNumber<Real, N>, Real>
+{
+  typedef DualNumber<Real, N> supertype;
+};
+
+template <unsigned int N>
+struct CompareTypes<Real, DualNumber<Real, N>>
+{
+  typedef DualNumber<Real, N> supertype;
+};
+} // namespace libMesh
+
+/// The dual number type used by automatic differentiation objects
+typedef DualNumber<Real, MOOSE_AD_MAX_DOFS_PER_ELEM> ADReal;
+typedef VectorValue<ADReal> ADRealGradient;
+
+typedef MooseArray<ADReal> ADVariableValue;
+typedef MooseArray<ADRealGradient> ADVariableGradient;
+
+#endif // DUALNUMBER_H
@@ -84,6 +84,24 @@ public:
 
   void clear();
 
+  /// The number of rows in the table
+  std::size_t numRows() const { return _data.size(); }
+
+  /// The number of rows already written to the CSV file
+  std::size_t outputRowIndex() const { return _output_row_index; }
+
+  /**
+   * Mark all rows as written, for outputs that write them from a copy of the table. The index is
+   * stored along with the table, so that a recovered run does not write the rows again.
+   */
+  void markRowsOutput() { _output_row_index = _data.size(); }
+
+  /**
+   * Append the rows of another table, starting at first_row, along with the columns
+   * this table does not have yet.
+   */
+  void appendRows(const FormattedTable & other, std::size_t first_row = 0);
+
   /**
    * Set whether or not to output time column.
    */
@@ -10,26 +10,386 @@
 #ifndef HASHMAP_H
 #define HASHMAP_H
 
-/// HashMap is an abstraction for dictionary data type, we make it thread-safe by locking inserts
 #include "libmesh/threads.h"
 
-#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
 
+/**
+ * Reader-writer spin lock. Any number of readers may hold the lock at the same time. A writer
+ * announces itself first, which blocks new readers, and then waits for the active readers to drain.
+ */
+class SpinRWMutex
+{
+public:
+  SpinRWMutex() : _state(0) {}
+
+  void lock_shared()
+  {
+    for (unsigned int spin = 0;; ++spin)
+    {
+      unsigned int state = _state.load(std::memory_order_relaxed);
+      if (!(state & WRITER) &&
+          _state.compare_exchange_weak(state, state + 1, std::memory_order_acquire))
+        return;
+      backoff(spin);
+    }
+  }
+
+  void unlock_shared() { _state.fetch_sub(1, std::memory_order_release); }
+
+  void lock()
+  {
+    // claim the writer bit
+    for (unsigned int spin = 0;; ++spin)
+    {
+      unsigned int state = _state.load(std::memory_order_relaxed);
+      if (!(state & WRITER) &&
+          _state.compare_exchange_weak(state, state | WRITER, std::memory_order_acquire))
+        break;
+      backoff(spin);
+    }
+
+    // wait for the readers that got in before us
+    for (unsigned int spin = 0; _state.load(std::memory_order_acquire) != WRITER; ++spin)
+      backoff(spin);
+  }
+
+  void unlock() { _state.store(0, std::memory_order_release); }
+
+  /// RAII helpers
+  class scoped_shared_lock
+  {
+  public:
+    scoped_shared_lock(SpinRWMutex & mutex) : _mutex(mutex) { _mutex.lock_shared(); }
+    ~scoped_shared_lock() { _mutex.unlock_shared(); }
+
+  private:
+    SpinRWMutex & _mutex;
+  };
+
+  class scoped_lock
+  {
+  public:
+    scoped_lock(SpinRWMutex & mutex) : _mutex(mutex) { _mutex.lock(); }
+    ~scoped_lock() { _mutex.unlock(); }
+
+  private:
+    SpinRWMutex & _mutex;
+  };
+
+private:
+  static void backoff(unsigned int spin)
+  {
+    if (spin > 64)
+      std::this_thread::yield();
+  }
+
+  static const unsigned int WRITER = 1u << 31;
+
+  /// writer bit plus the number of active readers
+  std::atomic<unsigned int> _state;
+};
+
+/**
+ * HashMap is a concurrent dictionary. Lookups (operator[] of an existing key, find(), at(),
+ * contains(), count() and iteration) are lock-free: they only load atomics and never write to
+ * memory shared with other threads. Inserts claim an empty slot of the open addressing table with
+ * a compare-and-swap, so threads inserting different keys do not block each other either. Only
+ * growing the table is exclusive; inserts hold the shared side of a SpinRWMutex for that, which
+ * readers never touch.
+ *
+ * Entries live in nodes that are never moved or freed before clear(), so references to values
+ * and iterators remain valid across inserts, and a table replaced by a larger one is kept until
+ * clear() for the readers that may still be probing it. Iteration walks the nodes from the most
+ * recent insert backwards. Entries cannot be erased. clear(), assignment and destruction must not
+ * run concurrently with any other access.
+ */
 template <typename Key, typename T>
-class HashMap : public std::unordered_map<Key, T>
+class HashMap
 {
+  struct Node
+  {
+    template <typename... Args>
+    Node(const Key & key, Args &&... args)
+      : value(std::piecewise_construct,
+              std::forward_as_tuple(key),
+              std::forward_as_tuple(std::forward<Args>(args)...)),
+        next(nullptr)
+    {
+    }
+    std::pair<const Key, T> value;
+    /// the node inserted before this one, set before this node is published
+    Node * next;
+  };
+
+  struct Table
+  {
+    Table(std::size_t size) : mask(size - 1), slots(new std::atomic<Node *>[size])
+    {
+      for (std::size_t i = 0; i < size; ++i)
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+    std::size_t mask;
+    std::unique_ptr<std::atomic<Node *>[]> slots;
+  };
+
+  template <typename V>
+  class IteratorBase : public std::iterator<std::forward_iterator_tag, V>
+  {
+  public:
+    IteratorBase(Node * node = nullptr) : _node(node) {}
+    template <typename V2>
+    IteratorBase(const IteratorBase<V2> & other) : _node(other._node)
+    {
+    }
+
+    V & operator*() const { return _node->value; }
+    V * operator->() const { return &_node->value; }
+    IteratorBase & operator++()
+    {
+      _node = _node->next;
+      return *this;
+    }
+    IteratorBase operator++(int)
+    {
+      IteratorBase it(*this);
+      _node = _node->next;
+      return it;
+    }
+    template <typename V2>
+    bool operator==(const IteratorBase<V2> & other) const
+    {
+      return _node == other._node;
+    }
+    template <typename V2>
+    bool operator!=(const IteratorBase<V2> & other) const
+    {
+      return _node != other._node;
+    }
+
+  private:
+    Node * _node;
+
+    template <typename>
+    friend class IteratorBase;
+  };
+
 public:
-  inline T & operator[](const Key & k)
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef IteratorBase<value_type> iterator;
+  typedef IteratorBase<const value_type> const_iterator;
+
+  HashMap() : _table(nullptr), _head(nullptr), _size(0) {}
+  HashMap(const HashMap & other) : HashMap() { insertAll(other); }
+  HashMap & operator=(const HashMap & other)
+  {
+    if (this != &other)
+    {
+      clear();
+      insertAll(other);
+    }
+    return *this;
+  }
+  ~HashMap() { clear(); }
+
+  /// Returns the value stored for \p k, inserting a default constructed one if there is none
+  inline T & operator[](const Key & k) { return try_emplace(k).first->second; }
+
+  /**
+   * Inserts a value constructed from \p args for \p k if there is none yet, like the C++17
+   * std::unordered_map::try_emplace()
+   * @return The entry for \p k and whether it was inserted by this call
+   */
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key & k, Args &&... args)
   {
-    libMesh::Threads::spin_mutex::scoped_lock lock(spin_mutex);
+    std::size_t hash = hashKey(k);
+    Node * node = findNode(k, hash);
+    if (node)
+      return {iterator(node), false};
 
-    return std::unordered_map<Key, T>::operator[](k);
+    Node * new_node = nullptr;
+    for (;;)
+    {
+      Table * full = nullptr;
+      {
+        SpinRWMutex::scoped_shared_lock lock(_resize_mutex);
+
+        Table * table = _table.load(std::memory_order_acquire);
+        // keep the load factor at or below one half so that probe sequences stay short
+        if (table && 2 * (_size.load(std::memory_order_relaxed) + 1) <= table->mask + 1)
+        {
+          std::size_t i = hash & table->mask;
+          for (std::size_t probes = 0; probes <= table->mask; ++probes, i = (i + 1) & table->mask)
+          {
+            node = table->slots[i].load(std::memory_order_acquire);
+            if (!node)
+            {
+              if (!new_node)
+                new_node = new Node(k, std::forward<Args>(args)...);
+              // on failure node is the entry another thread just put into this slot
+              if (table->slots[i].compare_exchange_strong(
+                      node, new_node, std::memory_order_acq_rel, std::memory_order_acquire))
+              {
+                link(new_node);
+                return {iterator(new_node), true};
+              }
+            }
+            if (node->value.first == k)
+            {
+              delete new_node;
+              return {iterator(node), false};
+            }
+          }
+        }
+        full = table;
+      }
+
+      grow(full);
+    }
+  }
+
+  inline T & at(const Key & k)
+  {
+    Node * node = findNode(k, hashKey(k));
+    if (!node)
+      throw std::out_of_range("HashMap::at: key not found");
+    return node->value.second;
   }
 
-  inline bool contains(const Key & key) { return this->find(key) != this->end(); }
+  inline const T & at(const Key & k) const { return const_cast<HashMap *>(this)->at(k); }
+
+  inline iterator find(const Key & k) { return iterator(findNode(k, hashKey(k))); }
+  inline const_iterator find(const Key & k) const
+  {
+    return const_iterator(findNode(k, hashKey(k)));
+  }
+
+  inline bool contains(const Key & k) const { return findNode(k, hashKey(k)) != nullptr; }
+  inline size_type count(const Key & k) const { return contains(k) ? 1 : 0; }
+
+  iterator begin() { return iterator(_head.load(std::memory_order_acquire)); }
+  iterator end() { return iterator(); }
+  const_iterator begin() const { return const_iterator(_head.load(std::memory_order_acquire)); }
+  const_iterator end() const { return const_iterator(); }
+
+  size_type size() const { return _size.load(std::memory_order_acquire); }
+  bool empty() const { return size() == 0; }
+
+  /// Removes all entries, must not run concurrently with any other access
+  void clear()
+  {
+    Node * node = _head.load(std::memory_order_relaxed);
+    while (node)
+    {
+      Node * next = node->next;
+      delete node;
+      node = next;
+    }
+
+    _head.store(nullptr, std::memory_order_relaxed);
+    _table.store(nullptr, std::memory_order_relaxed);
+    _tables.clear();
+    _size.store(0, std::memory_order_relaxed);
+  }
 
 private:
-  libMesh::Threads::spin_mutex spin_mutex;
+  /// Mixes the bits of the key hash: std::hash of a pointer is the address itself, whose low
+  /// bits (the ones selecting the slot) are always zero because of alignment
+  static std::size_t hashKey(const Key & k)
+  {
+    std::uint64_t h = std::hash<Key>()(k);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<std::size_t>(h);
+  }
+
+  Node * findNode(const Key & k, std::size_t hash) const
+  {
+    Table * table = _table.load(std::memory_order_acquire);
+    if (!table)
+      return nullptr;
+
+    std::size_t i = hash & table->mask;
+    for (std::size_t probes = 0; probes <= table->mask; ++probes, i = (i + 1) & table->mask)
+    {
+      Node * node = table->slots[i].load(std::memory_order_acquire);
+      if (!node)
+        return nullptr;
+      if (node->value.first == k)
+        return node;
+    }
+    return nullptr;
+  }
+
+  /// Adds a node that was just put into the table to the list iteration walks
+  void link(Node * node)
+  {
+    node->next = _head.load(std::memory_order_relaxed);
+    while (!_head.compare_exchange_weak(
+        node->next, node, std::memory_order_release, std::memory_order_relaxed))
+      ;
+    _size.fetch_add(1, std::memory_order_release);
+  }
+
+  /// Replaces \p full with a table twice as large, unless another thread already did
+  void grow(Table * full)
+  {
+    SpinRWMutex::scoped_lock lock(_resize_mutex);
+    if (_table.load(std::memory_order_relaxed) != full)
+      return;
+
+    // no insert is in flight while the exclusive lock is held, so every node is on the list
+    std::size_t n_slots = full ? 2 * (full->mask + 1) : 8;
+    while (n_slots < 2 * (_size.load(std::memory_order_relaxed) + 1))
+      n_slots *= 2;
+
+    std::unique_ptr<Table> table(new Table(n_slots));
+    for (Node * node = _head.load(std::memory_order_relaxed); node; node = node->next)
+    {
+      std::size_t i = hashKey(node->value.first) & table->mask;
+      while (table->slots[i].load(std::memory_order_relaxed))
+        i = (i + 1) & table->mask;
+      table->slots[i].store(node, std::memory_order_relaxed);
+    }
+
+    // the old table stays allocated for readers that are still probing it
+    _table.store(table.get(), std::memory_order_release);
+    _tables.push_back(std::move(table));
+  }
+
+  void insertAll(const HashMap & other)
+  {
+    for (const auto & entry : other)
+      (*this)[entry.first] = entry.second;
+  }
+
+  /// The table lookups probe
+  std::atomic<Table *> _table;
+
+  /// Every table allocated since the last clear(), the last one is the current one
+  std::vector<std::unique_ptr<Table>> _tables;
+
+  /// The most recently inserted node
+  std::atomic<Node *> _head;
+
+  std::atomic<size_type> _size;
+
+  /// Held shared by inserts and exclusively while the table grows, lookups never take it
+  SpinRWMutex _resize_mutex;
 };
 
 #endif /* HASHMAP_H */
@@ -32,6 +32,15 @@ public:
                       std::vector<std::size_t> & return_index,
                       std::vector<Real> & return_dist_sqr);
 
+  /**
+   * Find all points whose squared distance to the query point is less than radius_sqr.
+   * @param indices_dist Indices of the points found and their squared distances, in no
+   *        particular order
+   */
+  void radiusSearch(Point & query_point,
+                    Real radius_sqr,
+                    std::vector<std::pair<std::size_t, Real>> & indices_dist);
+
   /**
    * PointListAdaptor is required to use libMesh Point coordinate type with
    * nanoflann KDTree library. The member functions within the PointListAdaptor
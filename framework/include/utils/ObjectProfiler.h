@@ -0,0 +1,184 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef OBJECTPROFILER_H
+#define OBJECTPROFILER_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/threads.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Low overhead, hierarchical timer registry used to attribute run time to individual
+ * MooseObjects (Kernels, Materials, UserObjects, ...) inside the threaded loops.
+ *
+ * Sections are identified by integer ids handed out by registerSection(), which every
+ * MooseObject calls once at construction. Each thread records into its own call tree, so
+ * starting and stopping a timer neither locks nor touches shared memory. When the profiler is
+ * disabled (the default) a Timer costs a single branch.
+ */
+class ObjectProfiler
+{
+public:
+  ObjectProfiler();
+
+  /**
+   * Return the id of the section with the given name, creating it if necessary. Thread safe.
+   */
+  unsigned int registerSection(const std::string & name);
+
+  /// Name of a registered section
+  const std::string & sectionName(unsigned int section) const { return _section_names[section]; }
+
+  /**
+   * Start recording.
+   * @param n_threads Number of threads that will record into the profiler
+   * @param trace Whether to keep individual timer events for writeChromeTrace()
+   * @param max_trace_events Maximum number of trace events kept per thread
+   */
+  void enable(unsigned int n_threads, bool trace = false, std::size_t max_trace_events = 1000000);
+
+  bool enabled() const { return _enabled; }
+
+  ///@{
+  /**
+   * Start/stop timing a section on the given thread. Calls must be properly nested; prefer the
+   * Timer helper, which also stops the section during stack unwinding.
+   */
+  void start(unsigned int section, THREAD_ID tid);
+  void stop(THREAD_ID tid);
+  ///@}
+
+  /**
+   * Scoped timer: times the enclosing scope if the profiler is enabled
+   */
+  class Timer
+  {
+  public:
+    Timer(ObjectProfiler & profiler, unsigned int section, THREAD_ID tid)
+      : _profiler(profiler.enabled() ? &profiler : nullptr), _tid(tid)
+    {
+      if (_profiler)
+        _profiler->start(section, _tid);
+    }
+
+    ~Timer()
+    {
+      if (_profiler)
+        _profiler->stop(_tid);
+    }
+
+    Timer(const Timer &) = delete;
+    Timer & operator=(const Timer &) = delete;
+
+  private:
+    ObjectProfiler * _profiler;
+    const THREAD_ID _tid;
+  };
+
+  /**
+   * Print the call tree (summed over threads) as a table, followed by the sections with the
+   * largest exclusive time.
+   * @param max_depth Deepest tree level printed
+   * @param max_rows Number of sections listed in the exclusive time summary
+   */
+  void printTable(std::ostream & out, unsigned int max_depth = 4, unsigned int max_rows = 20) const;
+
+  /// Write the call tree (summed over threads) as JSON
+  void writeJSON(std::ostream & out) const;
+
+  /**
+   * Write the recorded timer events in the Chrome trace event format, which can be loaded
+   * into chrome://tracing or Perfetto.
+   * @param pid Process id written for every event, typically the processor id
+   */
+  void writeChromeTrace(std::ostream & out, unsigned int pid = 0) const;
+
+  /// Drop all recorded times and events (registered sections are kept)
+  void clear();
+
+protected:
+  typedef std::chrono::steady_clock Clock;
+
+  /// Node of the per-thread call tree; node 0 is the root
+  struct Node
+  {
+    unsigned int section;
+    unsigned int parent;
+    std::vector<unsigned int> children;
+    double time;
+    unsigned long long calls;
+  };
+
+  struct TraceEvent
+  {
+    unsigned int section;
+    double start;
+    double duration;
+  };
+
+  struct ThreadData
+  {
+    std::vector<Node> nodes;
+    std::vector<std::pair<unsigned int, Clock::time_point>> stack;
+    std::vector<TraceEvent> events;
+  };
+
+  /// Call tree merged over all threads, used for output
+  struct MergedNode
+  {
+    MergedNode() : time(0), calls(0) {}
+    double time;
+    unsigned long long calls;
+    std::map<unsigned int, MergedNode> children;
+
+    double childTime() const;
+  };
+
+  void merge(const ThreadData & data, unsigned int node, MergedNode & merged) const;
+  MergedNode mergedTree() const;
+
+  void printNode(std::ostream & out,
+                 const MergedNode & node,
+                 unsigned int section,
+                 unsigned int depth,
+                 unsigned int max_depth,
+                 double total) const;
+  void writeJSONNode(std::ostream & out,
+                     const MergedNode & node,
+                     unsigned int section,
+                     unsigned int indent) const;
+  void collectSelfTimes(const MergedNode & node,
+                        unsigned int section,
+                        std::vector<double> & self,
+                        std::vector<unsigned long long> & calls) const;
+
+  static std::string escape(const std::string & str);
+
+  bool _enabled;
+  bool _trace;
+  std::size_t _max_trace_events;
+  Clock::time_point _epoch;
+
+  std::vector<std::string> _section_names;
+  std::map<std::string, unsigned int> _section_ids;
+  Threads::spin_mutex _section_mutex;
+
+  /// Per thread data, allocated separately so that threads never share a cache line
+  std::vector<std::unique_ptr<ThreadData>> _threads;
+};
+
+#endif // OBJECTPROFILER_H
@@ -0,0 +1,119 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef TENSORPRODUCTBASIS_H
+#define TENSORPRODUCTBASIS_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/enum_elem_type.h"
+
+#include <memory>
+#include <vector>
+
+// Forward declarations
+namespace libMesh
+{
+class QBase;
+}
+
+/**
+ * Sum factorization kernels for second order Lagrange shape functions on QUAD9 and HEX27
+ * elements integrated with a tensor product quadrature rule.
+ *
+ * The reference shape functions are products of three 1D quadratic Lagrange polynomials, so
+ * evaluating a field (or contracting a residual against the shape functions) can be done one
+ * direction at a time. This costs O(p^(d+1)) operations per element instead of the
+ * O(p^(2d)) of the dense (dofs x qps) product.
+ *
+ * Values are exchanged in the element's local dof (node) order and in libMesh's quadrature
+ * point order. Gradients are taken with respect to the reference coordinates; mapping them to
+ * physical space is left to the caller, which has the inverse Jacobian at hand.
+ *
+ * The class holds scratch space, so an object must not be shared between threads.
+ */
+class TensorProductBasis
+{
+public:
+  /**
+   * Whether elements of the given type have a tensor product second order Lagrange basis
+   */
+  static bool isSupported(ElemType type);
+
+  /**
+   * Build the 1D tables for the given element type and (already initialized) quadrature rule.
+   * Returns nullptr if the quadrature rule is not a tensor product of a 1D rule or the libMesh
+   * basis does not match the expected node ordering.
+   */
+  static std::unique_ptr<TensorProductBasis> build(ElemType type, const QBase & qrule);
+
+  unsigned int dim() const { return _dim; }
+  unsigned int nDofs() const { return _n_dofs; }
+  unsigned int nQps() const { return _n_qps; }
+
+  /// The quadrature rule this basis was built for
+  const QBase * qrule() const { return _qrule; }
+
+  /**
+   * Evaluate a field at all quadrature points.
+   * @param dofs Nodal values, nDofs() entries in local dof order
+   * @param values Field values, nQps() entries (may be nullptr)
+   * @param ref_grad Reference gradients, dim() blocks of nQps() entries, one block per
+   *        reference direction (may be nullptr)
+   */
+  void interpolate(const Real * dofs, Real * values, Real * ref_grad) const;
+
+  /**
+   * Add the contraction of quadrature point data with the shape functions to a residual:
+   * residual[i] += sum_qp values[qp] * phi_i(qp) + sum_qp sum_r ref_grad[r][qp] * dphi_i/dxi_r(qp)
+   * @param values Weights of the shape function values (may be nullptr)
+   * @param ref_grad Weights of the reference shape function gradients, laid out as in
+   *        interpolate() (may be nullptr)
+   * @param residual nDofs() entries in local dof order
+   */
+  void integrate(const Real * values, const Real * ref_grad, Real * residual) const;
+
+protected:
+  TensorProductBasis(ElemType type, const QBase & qrule, const std::vector<Real> & points_1d);
+
+  /// Number of 1D quadratic Lagrange polynomials
+  static const unsigned int N1D = 3;
+
+  const unsigned int _dim;
+  const QBase * const _qrule;
+  unsigned int _n_dofs;
+  unsigned int _n_qps;
+
+  /// Number of quadrature points per direction
+  const unsigned int _nq;
+  /// Number of dofs and quadrature points in the third direction (1 for 2D elements)
+  const unsigned int _nd_z;
+  const unsigned int _nq_z;
+
+  ///@{ 1D basis values and derivatives, indexed [a * _nq + q]
+  std::vector<Real> _b;
+  std::vector<Real> _d;
+  ///@}
+
+  ///@{ 1D tables in the third direction, a single constant function for 2D elements
+  std::vector<Real> _b_z;
+  std::vector<Real> _d_z;
+  ///@}
+
+  /// Lexicographic (x fastest) index of the tensor basis function for each local dof
+  std::vector<unsigned int> _lex;
+
+  ///@{ Scratch space for the intermediate contractions
+  mutable std::vector<Real> _dofs_lex;
+  mutable std::vector<Real> _x[2];
+  mutable std::vector<Real> _xy[3];
+  ///@}
+};
+
+#endif // TENSORPRODUCTBASIS_H
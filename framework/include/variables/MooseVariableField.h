@@ -299,6 +299,13 @@ public:
                                    const FieldVariablePhiSecond *& second_phi,
                                    const FieldVariablePhiCurl *& curl_phi);
 
+  /**
+   * Compute the values at the volume quadrature points by sum factorization, if the current
+   * element, quadrature rule and FE type permit it (see Assembly::tensorProductBasis())
+   * @return Whether the values were computed
+   */
+  bool computeValuesTensorProduct();
+
   /**
    * Helper function for computing values
    */
@@ -453,9 +460,18 @@ protected:
   /// Increment in the variable used in dampers
   FieldVariableValue _increment;
 
+  ///@{ Scratch space for computeValuesTensorProduct()
+  std::vector<Real> _tensor_dofs;
+  std::vector<Real> _tensor_values;
+  std::vector<Real> _tensor_ref_grad;
+  ///@}
+
   friend class NodeFaceConstraint;
   friend class ValueThresholdMarker;
   friend class ValueRangeMarker;
 };
 
+template <>
+bool MooseVariableField<Real>::computeValuesTensorProduct();
+
 #endif /* MOOSEVARIABLEFIELD_H */
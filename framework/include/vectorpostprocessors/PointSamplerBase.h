@@ -36,7 +36,14 @@ public:
   virtual void execute();
   virtual void finalize();
 
+  virtual void meshChanged() override;
+
 protected:
+  /**
+   * Find the local elements containing the sample points and group the points by element.
+   */
+  void locatePoints();
+
   /**
    * Find the local element that contains the point.  This will attempt to use a cached element to
    * speed things up.
@@ -65,6 +72,21 @@ protected:
   unsigned int _qp;
 
   std::unique_ptr<PointLocatorBase> _pl;
+
+  /// Whether this sampler works on the displaced mesh, where the points are located on every execution
+  const bool _use_displaced_mesh;
+
+  /// Whether _local_elems is up to date with the mesh
+  bool _points_located;
+
+  /// The points _local_elems was built for
+  std::vector<Point> _located_points;
+
+  /// The local elements containing sample points
+  std::vector<const Elem *> _local_elems;
+
+  /// The indices of the points in each of the _local_elems
+  std::vector<std::vector<unsigned int>> _local_elem_points;
 };
 
 #endif
@@ -254,6 +254,34 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const = 0;
 
+  /**
+   * Batch versions of rho_mu_dpT(), e_dpT() and h_dpT(), evaluating all the points of an
+   * element in one call. The outputs are resized to the number of points. These call the
+   * pointwise methods, fluids that can share work between the points override them.
+   * @param pressure fluid pressure at each point (Pa)
+   * @param temperature fluid temperature at each point (K)
+   */
+  ///@{
+  virtual void rho_mu_dpT_batch(const std::vector<Real> & pressure,
+                                const std::vector<Real> & temperature,
+                                std::vector<Real> & rho,
+                                std::vector<Real> & drho_dp,
+                                std::vector<Real> & drho_dT,
+                                std::vector<Real> & mu,
+                                std::vector<Real> & dmu_dp,
+                                std::vector<Real> & dmu_dT) const;
+  virtual void e_dpT_batch(const std::vector<Real> & pressure,
+                           const std::vector<Real> & temperature,
+                           std::vector<Real> & e,
+                           std::vector<Real> & de_dp,
+                           std::vector<Real> & de_dT) const;
+  virtual void h_dpT_batch(const std::vector<Real> & pressure,
+                           const std::vector<Real> & temperature,
+                           std::vector<Real> & h,
+                           std::vector<Real> & dh_dp,
+                           std::vector<Real> & dh_dT) const;
+  ///@}
+
   /**
    * Isobaric thermal expansion coefficient, defined as
    * 1/v (dv/dT)_p, where v is the volume, and the derivative wrt temperature is
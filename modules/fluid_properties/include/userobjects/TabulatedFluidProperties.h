@@ -86,6 +86,13 @@ InputParameters validParams<TabulatedFluidProperties>();
  * Properties specified in the data file or listed in the input file (and their derivatives
  * wrt pressure and temperature) will be calculated using bicubic interpolation, while all
  * remaining fluid properties are calculated using the supplied FluidProperties UserObject.
+ *
+ * Generated data can be refined until the interpolation is within a relative error of the
+ * FluidProperties UserObject (error_tolerance): the pressure and temperature intervals where the
+ * error at their midpoint is too large are bisected, giving a non-uniform grid. Generated data
+ * can also be kept in a binary cache file (cache_file) instead of the csv file. The cache holds
+ * the data at full precision and is only read back if it was generated for the same fluid, ranges
+ * and refinement parameters.
  */
 class TabulatedFluidProperties : public SinglePhaseFluidPropertiesPT
 {
@@ -177,6 +184,43 @@ protected:
    */
   virtual void generateTabulatedData();
 
+  /**
+   * Bisects the pressure and temperature intervals of the generated data until the interpolation
+   * is within _error_tolerance of _fp at the midpoints of the intervals along each grid line, or
+   * until _max_refinement_levels is reached
+   */
+  void refineTabulatedData();
+
+  /**
+   * Computes a property using the FluidProperties UserObject _fp
+   * @param property name of the property (one of _property_columns)
+   * @param pressure fluid pressure (Pa)
+   * @param temperature fluid temperature (K)
+   */
+  Real fluidProperty(const std::string & property, Real pressure, Real temperature) const;
+
+  /// Constructs the bicubic interpolation of each property from the tabulated data
+  void constructInterpolation();
+
+  /**
+   * Describes the fluid and the parameters used to generate data, the cache file is only used if
+   * it was written with the same key
+   */
+  std::string cacheKey() const;
+
+  /**
+   * Reads the tabulated data from the cache file
+   * @param key the key of the data to read
+   * @return whether the file exists, was written with this key and could be read
+   */
+  bool readCachedData(const std::string & key);
+
+  /**
+   * Writes the generated data to the cache file
+   * @param key the key of the data
+   */
+  void writeCachedData(std::string key);
+
   /**
    * Forms a 2D matrix from a single std::vector.
    * @param nrow number of rows in the matrix
@@ -246,6 +290,13 @@ protected:
   unsigned int _cv_idx;
   unsigned int _entropy_idx;
 
+  /// Relative error that generated data are refined to (0 to keep the uniform grid)
+  const Real _error_tolerance;
+  /// Maximum number of refinement levels of generated data
+  const unsigned int _max_refinement_levels;
+  /// File name of the binary cache of generated data (empty if not used)
+  const std::string _cache_file;
+
   /// The MOOSE delimited file reader.
   MooseUtils::DelimitedFileReader _csv_reader;
 };
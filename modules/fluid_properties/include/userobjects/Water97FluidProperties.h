@@ -148,6 +148,27 @@ public:
   virtual void
   h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  virtual void rho_mu_dpT_batch(const std::vector<Real> & pressure,
+                                const std::vector<Real> & temperature,
+                                std::vector<Real> & rho,
+                                std::vector<Real> & drho_dp,
+                                std::vector<Real> & drho_dT,
+                                std::vector<Real> & mu,
+                                std::vector<Real> & dmu_dp,
+                                std::vector<Real> & dmu_dT) const override;
+
+  virtual void e_dpT_batch(const std::vector<Real> & pressure,
+                           const std::vector<Real> & temperature,
+                           std::vector<Real> & e,
+                           std::vector<Real> & de_dp,
+                           std::vector<Real> & de_dT) const override;
+
+  virtual void h_dpT_batch(const std::vector<Real> & pressure,
+                           const std::vector<Real> & temperature,
+                           std::vector<Real> & h,
+                           std::vector<Real> & dh_dp,
+                           std::vector<Real> & dh_dT) const override;
+
   /**
    * Saturation pressure as a function of temperature
    *
@@ -301,6 +322,38 @@ public:
   Real b3ab(Real pressure) const;
 
 protected:
+  /// The points of a batch that lie in region 1, with the derivatives of their Gibbs free energy
+  struct Region1Batch
+  {
+    /// Index of each point in the batch
+    std::vector<unsigned int> index;
+    /// Reduced pressure and temperature
+    std::vector<Real> pi;
+    std::vector<Real> tau;
+    ///@{ Derivatives of the Gibbs free energy
+    std::vector<Real> dg_dpi;
+    std::vector<Real> d2g_dpi2;
+    std::vector<Real> dg_dtau;
+    std::vector<Real> d2g_dtau2;
+    std::vector<Real> d2g_dpitau;
+    ///@}
+  };
+
+  /**
+   * Finds the points of a batch that lie in region 1 and evaluates the derivatives of their Gibbs
+   * free energy. The loop over the points is inside the loop over the coefficients, and the
+   * derivatives share the powers of each term.
+   *
+   * @param pressure water pressure at each point (Pa)
+   * @param temperature water temperature at each point (K)
+   * @param[out] batch the region 1 points
+   * @param[out] others the indices of the points in the other regions
+   */
+  void region1Batch(const std::vector<Real> & pressure,
+                    const std::vector<Real> & temperature,
+                    Region1Batch & batch,
+                    std::vector<unsigned int> & others) const;
+
   /**
    * Gibbs free energy in Region 1 - single phase liquid region
    *
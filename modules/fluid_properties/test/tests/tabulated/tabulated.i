@@ -111,7 +111,6 @@
     [./tabulated]
       type = TabulatedFluidProperties
       fp = co2
-      fluid_property_file = fluid_properties.csv
     [../]
   []
 []
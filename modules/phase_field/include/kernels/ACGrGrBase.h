@@ -14,6 +14,7 @@
 
 // Forward Declarations
 class ACGrGrBase;
+class GrainTrackerInterface;
 
 template <>
 InputParameters validParams<ACGrGrBase>();
@@ -22,19 +23,61 @@ InputParameters validParams<ACGrGrBase>();
  * This is the base class for kernels that calculate the residual for grain growth.
  * It calculates the residual of the ith order parameter, and the values of
  * all other order parameters are coupled variables and are stored in vals.
+ *
+ * If a grain tracker is supplied, only the order parameters that carry a grain (or the halo of
+ * a grain) on the current element are summed, the others are taken to be zero there.
  */
 class ACGrGrBase : public ACBulk<Real>
 {
 public:
   ACGrGrBase(const InputParameters & parameters);
 
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(MooseVariableFE & jvar) override;
+
 protected:
+  /**
+   * Collect the order parameters that are active on the current element, looking up the grains
+   * of the element only once per element
+   */
+  void updateActiveOps();
+
+  /**
+   * Index (into _vals) of the order parameter with variable number jvar, or
+   * libMesh::invalid_uint if jvar is not one of the other order parameters
+   */
+  unsigned int opIndex(unsigned int jvar) const
+  {
+    return jvar < _op_index.size() ? _op_index[jvar] : libMesh::invalid_uint;
+  }
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
 
   const MaterialProperty<Real> & _mu;
+
+  /// Grain tracker providing the active order parameters of each element (optional)
+  const GrainTrackerInterface * const _grain_tracker;
+
+  /// Index of each of the other order parameters in the variables of the grain tracker
+  std::vector<unsigned int> _tracker_var;
+
+  /// Index (into _vals) of the order parameter with a given variable number
+  std::vector<unsigned int> _op_index;
+
+  /// Indices (into _vals) of the order parameters summed on the current element
+  std::vector<unsigned int> _active_ops;
+
+  /// Whether the order parameter with a given index (into _vals) is active on the current element
+  std::vector<bool> _op_active;
+
+  /// The element _active_ops and _op_active were collected for
+  const Elem * _active_ops_elem;
 };
 
 #endif // ACGRGRBASE_H
@@ -51,7 +51,7 @@ private:
   /// The mapping of entities to grains, in this case always the order parameter
   std::map<dof_id_type, unsigned int> _entity_id_to_var_num;
 
-  std::map<dof_id_type, std::vector<unsigned int>> _entity_var_to_features;
+  HashMap<dof_id_type, std::vector<unsigned int>> _entity_var_to_features;
   std::vector<unsigned int> _empty_var_to_features;
 
   /// Used as the lightweight grain counter
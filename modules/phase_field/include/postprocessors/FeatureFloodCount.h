@@ -12,12 +12,14 @@
 
 #include "Coupleable.h"
 #include "GeneralPostprocessor.h"
+#include "HashMap.h"
 #include "InfixIterator.h"
 #include "MooseVariableDependencyInterface.h"
 
 #include <iterator>
 #include <list>
 #include <set>
+#include <unordered_set>
 #include <vector>
 
 #include "libmesh/mesh_tools.h"
@@ -303,13 +305,24 @@ protected:
   /**
    * This method will "mark" all entities on neighboring elements that
    * are above the supplied threshold. If feature is NULL, we are exploring
-   * for a new region to mark, otherwise we are in the recursive calls
-   * currently marking a region.
+   * for a new region to mark, otherwise the entities are added to the passed in feature.
+   * The region is explored with an explicit stack of entities rather than with recursion so
+   * that large features can't overflow the call stack.
    *
    * @return Boolean indicating whether a new feature was found while exploring the current entity.
    */
   bool flood(const DofObject * dof_object, std::size_t current_index, FeatureData * feature);
 
+  /**
+   * Inspects and marks a single entity of the flood. If it's part of a feature, its neighbors
+   * are pushed onto _flood_stack.
+   *
+   * @return Boolean indicating whether the entity was added to a feature.
+   */
+  bool floodEntity(const DofObject * dof_object,
+                   std::size_t & current_index,
+                   FeatureData *& feature);
+
   /**
    * Return the starting comparison threshold to use when inspecting an entity during the flood
    * stage.
@@ -330,7 +343,7 @@ protected:
   bool compareValueWithThreshold(Real entity_value, Real threshold) const;
 
   /**
-   * Method called during the recursive flood routine that should return whether or not the current
+   * Method called during the flood routine that should return whether or not the current
    * entity is part of the current feature (if one is being explored), or if it's the start
    * of a new feature.
    */
@@ -378,7 +391,7 @@ protected:
    */
   template <typename T>
   void visitNeighborsHelper(const T * curr_entity,
-                            std::vector<const T *> neighbor_entities,
+                            const std::vector<const T *> & neighbor_entities,
                             std::size_t current_index,
                             FeatureData * feature,
                             bool expand_halos_only,
@@ -400,12 +413,14 @@ protected:
 
   ///@{
   /**
-   * These routines packs/unpack the _feature_map data into a structure suitable for parallel
-   * communication operations. See the comments in these routines for the exact
-   * data structure layout.
+   * These routines packs/unpack partial feature sets (laid out like _partial_feature_sets) into
+   * a byte buffer suitable for parallel communication operations. Unpacking appends the
+   * features to the ones already in the lists.
    */
-  void serialize(std::string & serialized_buffer);
-  void deserialize(std::vector<std::string> & serialized_buffers);
+  void serialize(std::string & serialized_buffer,
+                 std::vector<std::list<FeatureData>> & partial_feature_sets);
+  void deserialize(const std::string & serialized_buffer,
+                   std::vector<std::list<FeatureData>> & partial_feature_sets);
   ///@}
 
   /**
@@ -414,6 +429,12 @@ protected:
    */
   void mergeSets();
 
+  /**
+   * Merges the mergeable features within each list of partial features, until no more
+   * features can be merged.
+   */
+  void mergePartialFeatures(std::vector<std::list<FeatureData>> & partial_feature_sets);
+
   /**
    * Method for determining whether two features are mergeable. This routine exists because
    * derived classes may need to override this function rather than use the mergeable method
@@ -421,6 +442,12 @@ protected:
    */
   virtual bool areFeaturesMergeable(const FeatureData & f1, const FeatureData & f2) const;
 
+  /**
+   * Whether areFeaturesMergeable() is only true for features whose bounding boxes intersect or
+   * that share periodic nodes. This lets mergePartialFeatures() skip every other pair.
+   */
+  virtual bool mergeableFeaturesOverlap() const { return true; }
+
   /**
    * This routine handles all of the serialization, communication and deserialization of the data
    * structures containing FeatureData objects.
@@ -567,8 +594,12 @@ protected:
    * _feature_map for this since we don't want to explicitly store data for all the unmarked nodes
    * in a serialized datastructures.
    * This keeps our overhead down since this variable never needs to be communicated.
+   * The entities are only ever looked up, never iterated in order, so a hash set is used.
    */
-  std::vector<std::set<dof_id_type>> _entities_visited;
+  std::vector<std::unordered_set<dof_id_type>> _entities_visited;
+
+  /// Entities waiting to be inspected by the current flood
+  std::vector<const DofObject *> _flood_stack;
 
   /**
    * This map keeps track of which variables own which nodes.  We need a vector of them for multimap
@@ -576,7 +607,7 @@ protected:
    *
    * Note: This map is only populated when "show_var_coloring" is set to true.
    */
-  std::vector<std::map<dof_id_type, int>> _var_index_maps;
+  std::vector<HashMap<dof_id_type, int>> _var_index_maps;
 
   /// The data structure used to find neighboring elements give a node ID
   std::vector<std::vector<const Elem *>> _nodes_to_elem_map;
@@ -603,9 +634,10 @@ protected:
   /**
    * The feature maps contain the raw flooded node information and eventually the unique grain
    * numbers.  We have a vector of them so we can create one per variable if that level of detail
-   * is desired.
+   * is desired. They are looked up from threaded aux kernels and never iterated, so they are
+   * hashed.
    */
-  std::vector<std::map<dof_id_type, int>> _feature_maps;
+  std::vector<HashMap<dof_id_type, int>> _feature_maps;
 
   /// The vector recording the local to global feature indices
   std::vector<std::size_t> _local_to_global_feature_map;
@@ -622,7 +654,7 @@ protected:
   const PostprocessorValue & _element_average_value;
 
   /// The map for holding reconstructed ghosted element information
-  std::map<dof_id_type, int> _ghosted_entity_ids;
+  HashMap<dof_id_type, int> _ghosted_entity_ids;
 
   /**
    * The data structure for looking up halos around features. The outer vector is for splitting out
@@ -640,7 +672,7 @@ protected:
   /// if features intersect any boundary
   std::set<dof_id_type> _all_boundary_entity_ids;
 
-  std::map<dof_id_type, std::vector<unsigned int>> _entity_var_to_features;
+  HashMap<dof_id_type, std::vector<unsigned int>> _entity_var_to_features;
 
   std::vector<unsigned int> _empty_var_to_features;
 
@@ -117,6 +117,12 @@ protected:
    */
   void broadcastAndUpdateGrainData();
 
+  /**
+   * Finds, for every grain, the indices (sorted) of the other grains whose bounding boxes
+   * intersect one of its own, binning the bounding boxes into a uniform grid of cells.
+   */
+  void computeBoundingBoxNeighbors(std::vector<std::vector<std::size_t>> & neighbors) const;
+
   /**
    * Populates and sorts a min_distances vector with the minimum distances to all grains in the
    * simulation for a given grain. There are _vars.size() entries in the outer vector, one for
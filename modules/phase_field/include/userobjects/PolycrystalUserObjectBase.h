@@ -103,6 +103,7 @@ public:
 
 protected:
   virtual bool areFeaturesMergeable(const FeatureData & f1, const FeatureData & f2) const override;
+  virtual bool mergeableFeaturesOverlap() const override { return _colors_assigned; }
   virtual bool isNewFeatureOrConnectedRegion(const DofObject * dof_object,
                                              std::size_t & current_index,
                                              FeatureData *& feature,
@@ -0,0 +1,38 @@
+# A single feature covering a large mesh. Flooding it used to recurse once per element, which
+# overflowed the stack.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 500
+  ny = 500
+[]
+
+[Variables]
+  [./u]
+    order = CONSTANT
+    family = MONOMIAL
+    initial_condition = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./flood_count_pp]
+    type = FeatureFloodCount
+    variable = u
+    threshold = 1.0
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,57 @@
+# The linear partitioner splits the mesh into horizontal bands, one per processor. The two legs of
+# the U shaped feature are separate pieces on every band but the top one, so the pieces of the
+# legs only merge into one feature through the top bar. The stripe inside the U crosses the lower
+# bands without touching it.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 20
+  partitioner = linear
+[]
+
+[Variables]
+  [./u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Functions]
+  [./shapes]
+    type = ParsedFunction
+    value = 'if((((x>0.2)&(x<0.3))|((x>0.7)&(x<0.8)))&(y<0.9), 2,
+             if((x>0.2)&(x<0.8)&(y>0.9), 2,
+             if((x>0.45)&(x<0.55)&(y<0.8), 2, 0)))'
+  [../]
+[]
+
+[ICs]
+  [./u_ic]
+    type = FunctionIC
+    function = shapes
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./flood_count_pp]
+    type = FeatureFloodCount
+    variable = u
+    threshold = 1.0
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
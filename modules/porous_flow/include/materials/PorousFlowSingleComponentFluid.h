@@ -13,6 +13,8 @@
 #include "PorousFlowFluidPropertiesBase.h"
 #include "SinglePhaseFluidPropertiesPT.h"
 
+#include <array>
+
 class PorousFlowSingleComponentFluid;
 
 template <>
@@ -30,8 +32,12 @@ public:
 
 protected:
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
 
+  /// Copy the values computed for all the qps or nodes into a material property
+  void copyBatchValues(const std::vector<Real> & values, MaterialProperty<Real> & prop) const;
+
   /// If true, this Material will compute density and viscosity, and their derivatives
   const bool _compute_rho_mu;
 
@@ -79,6 +85,14 @@ protected:
 
   /// Fluid properties UserObject
   const SinglePhaseFluidPropertiesPT & _fp;
+
+  ///@{ Pressure and temperature (K) at all the qps or nodes of the current element
+  std::vector<Real> _batch_pressure;
+  std::vector<Real> _batch_temperature;
+  ///@}
+
+  /// Properties and derivatives computed for all the qps or nodes by one batch call
+  std::array<std::vector<Real>, 6> _batch_values;
 };
 
 #endif // POROUSFLOWSINGLECOMPONENTFLUID_H
@@ -16,6 +16,8 @@
 #include "Sampler.h"
 
 class SamplerMultiApp;
+class SamplerTransfer;
+class SamplerPostprocessorTransfer;
 
 template <>
 InputParameters validParams<SamplerMultiApp>();
@@ -25,14 +27,48 @@ class SamplerMultiApp : public TransientMultiApp, public SamplerInterface
 public:
   SamplerMultiApp(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
+  virtual bool solveStep(Real dt, Real target_time, bool auto_advance = true) override;
+
   /**
    * Return the Sampler object for this MultiApp.
    */
   Sampler & getSampler() const { return _sampler; }
 
+  /**
+   * Whether a single sub-application is reused for all the Sampler rows of a processor.
+   */
+  bool isBatchMode() const { return _batch_mode; }
+
+  ///@{
+  /**
+   * Register the transfers that this MultiApp executes for each row it solves in batch mode.
+   */
+  void addBatchTransfer(SamplerTransfer & transfer);
+  void addBatchTransfer(SamplerPostprocessorTransfer & transfer);
+  ///@}
+
 protected:
   /// Sampler to utilize for creating MultiApps
   Sampler & _sampler;
+
+  /// Whether the sub-application is reset and reused for each row ('batch-reset' mode)
+  const bool _batch_mode;
+
+  ///@{ The range of Sampler rows solved by the local sub-application in batch mode
+  unsigned int _batch_first_row;
+  unsigned int _batch_num_rows;
+  ///@}
+
+  /// State of the local sub-application before its first step, restored before each row
+  std::shared_ptr<Backup> & _batch_backup;
+
+  /// Transfers setting the parameters of each row in batch mode
+  std::vector<SamplerTransfer *> _batch_to_transfers;
+
+  /// Transfers collecting the results of each row in batch mode
+  std::vector<SamplerPostprocessorTransfer *> _batch_from_transfers;
 };
 
 #endif
@@ -32,6 +32,13 @@ public:
   SamplerPostprocessorTransfer(const InputParameters & parameters);
   virtual void initialSetup() override;
 
+  /**
+   * Collect the Postprocessor value of the local sub-application after it solved a Sampler row,
+   * used by the SamplerMultiApp in batch mode. The values are gathered by the next execute().
+   * @param row The global row index
+   */
+  void executeBatchRow(unsigned int row);
+
 protected:
   virtual void executeFromMultiapp() override;
 
@@ -43,6 +50,11 @@ protected:
 
   /// Storage for StochasticResults object that data will be transferred to/from
   StochasticResults * _results;
+
+  ///@{ Rows solved on this processor in batch mode and their Postprocessor values
+  std::vector<unsigned int> _batch_rows;
+  std::vector<PostprocessorValue> _batch_values;
+  ///@}
 };
 
 #endif
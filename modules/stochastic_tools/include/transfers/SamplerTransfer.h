@@ -30,12 +30,31 @@ public:
   SamplerTransfer(const InputParameters & parameters);
   virtual void execute() override;
 
+  /**
+   * Set the parameters of the local sub-application to a Sampler row, used by the
+   * SamplerMultiApp in batch mode.
+   * @param samples The Sampler data, as returned by Sampler::getSamples()
+   * @param row The global row index
+   */
+  void executeBatchRow(const std::vector<DenseMatrix<Real>> & samples, unsigned int row);
+
 protected:
+  /**
+   * Set the parameters of a sub-application to a Sampler row.
+   * @param app_index The global sub-app index
+   * @param row The global row index
+   */
+  void transferRow(unsigned int app_index,
+                   unsigned int row,
+                   const std::vector<DenseMatrix<Real>> & samples);
+
   /**
    * Return the SamplerReceiver object and perform error checking.
    * @param app_index The global sup-app index
+   * @param row The global row index
    */
   SamplerReceiver * getReceiver(unsigned int app_index,
+                                unsigned int row,
                                 const std::vector<DenseMatrix<Real>> & samples);
 
   /// Storage for the list of parameters to control
@@ -47,8 +66,11 @@ protected:
   /// The name of the SamplerReceiver Control object on the sub-application
   const std::string & _receiver_name;
 
-  /// The matrix and row for each MultiApp
+  /// The matrix and row for each global row index
   std::vector<std::pair<unsigned int, unsigned int>> _multi_app_matrix_row;
+
+  /// The SamplerMultiApp sets the parameters of each row itself in batch mode
+  bool _batch_mode;
 };
 
 #endif
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADMATDIFFUSIONTEST_H
+#define ADMATDIFFUSIONTEST_H
+
+#include "ADKernel.h"
+
+class ADMatDiffusionTest;
+
+template <>
+InputParameters validParams<ADMatDiffusionTest>();
+
+/**
+ * Diffusion with an AD material property diffusivity, (D grad_u, grad_test), plus an optional
+ * AD-coupled reaction term (v u, test) used to exercise off-diagonal Jacobian blocks.
+ */
+class ADMatDiffusionTest : public ADKernel
+{
+public:
+  ADMatDiffusionTest(const InputParameters & parameters);
+
+protected:
+  virtual ADReal computeQpADResidual() override;
+
+  const MaterialProperty<ADReal> & _diffusivity;
+
+  const bool _has_v;
+  const ADVariableValue * _v;
+};
+
+#endif // ADMATDIFFUSIONTEST_H
@@ -0,0 +1,38 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADCOUPLEDDIFFUSIVITYTESTMATERIAL_H
+#define ADCOUPLEDDIFFUSIVITYTESTMATERIAL_H
+
+#include "ADMaterial.h"
+
+class ADCoupledDiffusivityTestMaterial;
+
+template <>
+InputParameters validParams<ADCoupledDiffusivityTestMaterial>();
+
+/**
+ * Computes the AD property diffusivity = 1 + u^2 + exp(v) + |grad u|^2
+ */
+class ADCoupledDiffusivityTestMaterial : public ADMaterial
+{
+public:
+  ADCoupledDiffusivityTestMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  const ADVariableValue & _u;
+  const ADVariableGradient & _grad_u;
+  const ADVariableValue & _v;
+
+  MaterialProperty<ADReal> & _diffusivity;
+};
+
+#endif // ADCOUPLEDDIFFUSIVITYTESTMATERIAL_H
@@ -0,0 +1,118 @@
+###########################################################
+# The nearest nodes on the right boundary are kept for the
+# slave nodes on the left boundary that did not move far
+# enough for another node to become the nearest one. The
+# bottom left node moves past that bound in every time step
+# and has to be searched again:
+#
+#   t = 1: (0, 0.2)  is nearest to (1, 0.25)
+#   t = 2: (0, 0.05) is nearest to (1, 0)
+#
+# which is sqrt(1.0025) away both times. The top left node
+# only creeps to the left and keeps its nearest node.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 1
+  ny = 4
+  displacements = 'disp_x disp_y'
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+  [./disp_y]
+  [../]
+  [./distance]
+  [../]
+[]
+
+[Functions]
+  [./disp_x_fun]
+    type = ParsedFunction
+    value = 'if(x<0.5, if(y>0.9, -0.001*t, 0), 0)'
+  [../]
+  [./disp_y_fun]
+    type = ParsedFunction
+    value = 'if(x<0.5, if(y<0.1, if(t<1.5, 0.2, 0.05), 0), 0)'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./disp_x]
+    type = FunctionAux
+    variable = disp_x
+    function = disp_x_fun
+  [../]
+  [./disp_y]
+    type = FunctionAux
+    variable = disp_y
+    function = disp_y_fun
+  [../]
+  [./distance]
+    type = NearestNodeDistanceAux
+    variable = distance
+    boundary = left
+    paired_boundary = right
+    use_displaced_mesh = true
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./moving]
+    type = PointValue
+    variable = distance
+    point = '0 0 0'
+  [../]
+  [./creeping]
+    type = PointValue
+    variable = distance
+    point = '0 1 0'
+  [../]
+  [./still]
+    type = PointValue
+    variable = distance
+    point = '0 0.5 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
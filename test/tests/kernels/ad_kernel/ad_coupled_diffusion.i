@@ -0,0 +1,63 @@
+###########################################################
+# Jacobian test of an ADKernel using an ADMaterial property
+# that depends on two coupled variables.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[ICs]
+  [./u_IC]
+    type = FunctionIC
+    variable = u
+    function = 'x * y'
+  [../]
+  [./v_IC]
+    type = FunctionIC
+    variable = v
+    function = 'sin(x) + y'
+  [../]
+[]
+
+[Kernels]
+  [./u_diff]
+    type = ADMatDiffusionTest
+    variable = u
+    v = v
+  [../]
+  [./v_diff]
+    type = ADMatDiffusionTest
+    variable = v
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = ADCoupledDiffusivityTestMaterial
+    u = u
+    v = v
+  [../]
+[]
+
+[Preconditioning]
+  [./smp]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
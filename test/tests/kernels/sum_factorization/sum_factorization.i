@@ -0,0 +1,74 @@
+# Solves -div(grad(u)) = 2 on the unit cube with u = 0 at x = 0 and x = 1. The exact solution
+# u = x (1 - x) is in the second order Lagrange space, so the integral of u is 1/6 no matter
+# whether the values and residuals are computed by sum factorization or not.
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 2
+  ny = 2
+  nz = 2
+  elem_type = HEX27
+[]
+
+[Problem]
+  use_sum_factorization = true
+[]
+
+[Variables]
+  [./u]
+    order = SECOND
+  [../]
+[]
+
+[AuxVariables]
+  [./f]
+    order = SECOND
+    initial_condition = -2
+  [../]
+[]
+
+[Kernels]
+  # KernelGrad
+  [./diff]
+    type = DiffusionPrecompute
+    variable = u
+  [../]
+  # KernelValue
+  [./source]
+    type = CoupledKernelValueTest
+    variable = u
+    var2 = f
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,70 @@
+#
+# Solve with a diffusivity from a ParsedMaterial that only depends on an auxiliary
+# variable, so that the cached material properties are reused in every residual and
+# Jacobian evaluation after the first one
+#
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./eta]
+    [./InitialCondition]
+      type = FunctionIC
+      function = x
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = ParsedMaterial
+    f_name = D
+    args = 'eta'
+    function = '(eta-0.5)^2+1'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = D
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Problem]
+  cache_pure_materials = true
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  exodus = true
+[]
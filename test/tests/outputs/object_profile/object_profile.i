@@ -0,0 +1,62 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = MatDiffusion
+    variable = u
+    prop_name = D
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = NeumannBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Materials]
+  [./diffusivity]
+    type = GenericConstantMaterial
+    prop_names = D
+    prop_values = 2
+  [../]
+[]
+
+[Postprocessors]
+  [./integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  [./profile]
+    type = ObjectProfile
+    output_json = true
+    output_trace = true
+  [../]
+[]
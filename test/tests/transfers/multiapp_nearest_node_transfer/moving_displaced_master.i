@@ -0,0 +1,74 @@
+# The nearest nodes found in the first time step must not be reused after the displaced sub
+# mesh moved. The sub nodes are at x = 2 and 3 after the first step and at x = 4 and 5 after the
+# second one.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 5
+  xmax = 5
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./at_3]
+    type = PointValue
+    variable = from_sub
+    point = '3 0 0'
+  [../]
+  [./at_5]
+    type = PointValue
+    variable = from_sub
+    point = '5 0 0'
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0'
+    input_files = moving_displaced_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_sub
+    displaced_source_mesh = true
+  [../]
+[]
@@ -0,0 +1,65 @@
+# The sub mesh has two nodes with u = 0 and u = 1 that move by 2 * t, so that every time step
+# they are nearest to different nodes of the master mesh
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+  displacements = 'disp_x'
+  # Transferring data from a sub application is currently only
+  # supported with a ReplicatedMesh
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./disp_x]
+  [../]
+[]
+
+[Functions]
+  [./disp_fun]
+    type = ParsedFunction
+    value = 2*t
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./disp_kern]
+    type = FunctionAux
+    variable = disp_x
+    function = disp_fun
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+  solve_type = NEWTON
+[]
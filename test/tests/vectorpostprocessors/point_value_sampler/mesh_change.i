@@ -0,0 +1,95 @@
+# Several sample points share an element until the mesh is refined after the first step.
+# The solution is linear, so the sampled values are exact.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./diff_v]
+    type = Diffusion
+    variable = v
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+  [./left_v]
+    type = DirichletBC
+    variable = v
+    boundary = left
+    value = 1
+  [../]
+  [./right_v]
+    type = DirichletBC
+    variable = v
+    boundary = right
+    value = 0
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 1
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./point_value]
+    type = PointValue
+    variable = u
+    point = '0.4 0.15 0'
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./point_sample]
+    type = PointValueSampler
+    variable = 'u v'
+    points = '0.1 0.1 0  0.2 0.3 0  0.4 0.15 0  0.8 0.7 0'
+    sort_by = id
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  execute_on = 'timestep_end'
+  csv = true
+[]